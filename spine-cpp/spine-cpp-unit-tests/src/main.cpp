@@ -1,6 +1,9 @@
 #include <spine/Debug.h>
 #include <spine/spine.h>
 #include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
 
 #ifdef MSVC
 #pragma warning(disable : 4710)
@@ -98,6 +101,1465 @@ void testLoading() {
 	}
 }
 
+static void recordPose(Skeleton *skeleton, Vector<float> &pose) {
+	Vector<Bone *> &bones = skeleton->getBones();
+	for (size_t i = 0; i < bones.size(); i++) {
+		Bone *bone = bones[i];
+		pose.add(bone->getA());
+		pose.add(bone->getB());
+		pose.add(bone->getC());
+		pose.add(bone->getD());
+		pose.add(bone->getWorldX());
+		pose.add(bone->getWorldY());
+	}
+	Vector<Slot *> &drawOrder = skeleton->getDrawOrder();
+	for (size_t i = 0; i < drawOrder.size(); i++) {
+		Slot *slot = drawOrder[i];
+		pose.add((float) slot->getData().getIndex());
+		pose.add(slot->getColor().a);
+		pose.add(slot->getAttachment() ? (float) slot->getAttachment()->getName().length() : -1);
+		for (size_t ii = 0; ii < slot->getDeform().size(); ii++)
+			pose.add(slot->getDeform()[ii]);
+	}
+}
+
+static void replay(Skeleton *skeleton, AnimationState *state, int frames, Vector<float> &pose) {
+	for (int i = 0; i < frames; i++) {
+		state->update(1 / 60.0f);
+		state->apply(*skeleton);
+		skeleton->updateWorldTransform();
+		recordPose(skeleton, pose);
+	}
+}
+
+void testPoseSnapshot() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing pose snapshots\n");
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+
+	Vector<float> pose, replayed;
+	state->setAnimation(0, "walk", true);
+	state->setAnimation(1, "aim", true)->setAlpha(0.5f);
+	replay(skeleton, state, 20, pose);
+	state->setAnimation(0, "run", true);
+	state->addAnimation(0, "jump", false, 2);
+	replay(skeleton, state, 3, pose);
+
+	// Capture in the middle of the walk to run mix, with a queued entry, then replay from the snapshot.
+	SkeletonPose snapshot;
+	snapshot.capture(*skeleton, *state);
+	pose.clear();
+	replay(skeleton, state, 15, pose);
+
+	for (int i = 0; i < 2; i++) {
+		bool restored = snapshot.restore(*skeleton, *state);
+		assert(restored);
+		SP_UNUSED(restored);
+		replayed.clear();
+		replay(skeleton, state, 15, replayed);
+		assert(pose.size() == replayed.size());
+		assert(memcmp(pose.buffer(), replayed.buffer(), pose.size() * sizeof(float)) == 0);
+	}
+
+	// Once the captured track entries are replaced, restoring fails and leaves the skeleton as it was.
+	state->setAnimation(0, "idle", true);
+	pose.clear();
+	replayed.clear();
+	recordPose(skeleton, pose);
+	bool restored = snapshot.restore(*skeleton, *state);
+	assert(!restored);
+	recordPose(skeleton, replayed);
+	assert(memcmp(pose.buffer(), replayed.buffer(), pose.size() * sizeof(float)) == 0);
+
+	// Track entries are pooled, so a replacement entry can reuse the captured entry's address.
+	state->clearTracks();
+	TrackEntry *captured = state->setAnimation(0, "walk", true);
+	replay(skeleton, state, 5, pose);
+	snapshot.capture(*skeleton, *state);
+	state->clearTrack(0);
+	TrackEntry *reused = state->setAnimation(0, "run", true);
+	assert(reused == captured);
+	restored = snapshot.restore(*skeleton, *state);
+	assert(!restored && reused->getTrackTime() == 0);
+	SP_UNUSED(restored);
+	SP_UNUSED(captured);
+	SP_UNUSED(reused);
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+static void assertSameUpdateCache(Skeleton *a, Skeleton *b) {
+	Vector<Updatable *> &cacheA = a->getUpdateCacheList(), &cacheB = b->getUpdateCacheList();
+	assert(cacheA.size() == cacheB.size());
+	for (size_t i = 0; i < cacheA.size(); i++) {
+		assert(cacheA[i]->getRTTI().isExactly(cacheB[i]->getRTTI()));
+		if (cacheA[i]->getRTTI().isExactly(Bone::rtti))
+			assert(&static_cast<Bone *>(cacheA[i])->getData() == &static_cast<Bone *>(cacheB[i])->getData());
+	}
+	for (size_t i = 0; i < a->getBones().size(); i++)
+		assert(a->getBones()[i]->isActive() == b->getBones()[i]->isActive());
+	SP_UNUSED(cacheB);
+}
+
+void testSkinUpdateCaches() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing skin update caches\n");
+	loadJson("testdata/stretchyman/stretchyman-pro.json", "testdata/stretchyman/stretchyman.atlas", atlas, skeletonData,
+			 stateData, skeleton, state);
+	assert(skeleton->getPathConstraints().size() > 0);
+	Skeleton *reference = new (__FILE__, __LINE__) Skeleton(skeletonData);
+
+	// More distinct skins than the memo holds, switched round robin so cached update caches are evicted and rebuilt.
+	Vector<Skin *> skins;
+	for (int i = 0; i < 12; i++) {
+		Skin *skin = new (__FILE__, __LINE__) Skin("skin");
+		skin->addSkin(skeletonData->getDefaultSkin());
+		skin->getBones().add(skeletonData->getBones()[1 + i]);
+		skins.add(skin);
+	}
+	for (int round = 0; round < 3; round++) {
+		for (size_t i = 0; i < skins.size(); i++) {
+			skeleton->setSkin(skins[i]);
+			reference->setSkin(skins[i]);
+			reference->updateCache();
+			assertSameUpdateCache(skeleton, reference);
+		}
+	}
+	skeleton->setSkin(NULL);
+	reference->setSkin(NULL);
+	reference->updateCache();
+	assertSameUpdateCache(skeleton, reference);
+
+	delete reference;
+	ContainerUtil::cleanUpVectorOfPointers(skins);
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testChangeTracking() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing change tracking\n");
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	Skeleton *tracked = new (__FILE__, __LINE__) Skeleton(skeletonData);
+	AnimationState *trackedState = new (__FILE__, __LINE__) AnimationState(stateData);
+	tracked->setChangeTracking(true);
+
+	// Idle keys few bones, the aim track drives IK, and moving the skeleton or a bone must update its subtree.
+	Vector<float> pose, trackedPose;
+	for (int i = 0; i < 4; i++) {
+		const char *animations[] = {"idle", "walk", "idle", "death"};
+		state->setAnimation(0, animations[i], true);
+		trackedState->setAnimation(0, animations[i], true);
+		if (i == 1) {
+			state->setAnimation(1, "aim", true);
+			trackedState->setAnimation(1, "aim", true);
+		}
+		if (i == 2) {
+			skeleton->setX(50);
+			tracked->setX(50);
+			skeleton->findBone("muzzle")->setRotation(30);
+			tracked->findBone("muzzle")->setRotation(30);
+		}
+		pose.clear();
+		trackedPose.clear();
+		replay(skeleton, state, 30, pose);
+		replay(tracked, trackedState, 30, trackedPose);
+		assert(pose.size() == trackedPose.size());
+		assert(memcmp(pose.buffer(), trackedPose.buffer(), pose.size() * sizeof(float)) == 0);
+	}
+
+	delete trackedState;
+	delete tracked;
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testEstimatedBounds() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing estimated bounds\n");
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	AnimationBounds bounds(skeletonData);
+	skeleton->setX(100);
+	skeleton->setScaleX(-0.5f);
+	skeleton->setScaleY(0.5f);
+
+	Vector<float> vertices;
+	const char *animations[] = {"walk", "run", "jump", "idle"};
+	for (int i = 0; i < 4; i++) {
+		skeleton->setToSetupPose();
+		state->setAnimation(0, animations[i], true);
+		for (int frame = 0; frame < 90; frame++) {
+			state->update(1 / 60.0f);
+			state->apply(*skeleton);
+			skeleton->updateWorldTransform();
+			float x, y, width, height, boundsX, boundsY, boundsWidth, boundsHeight;
+			skeleton->getBounds(x, y, width, height, vertices);
+			bool found = skeleton->getEstimatedBounds(*state, bounds, boundsX, boundsY, boundsWidth, boundsHeight);
+			assert(found);
+			SP_UNUSED(found);
+			assert(x >= boundsX - 0.01f && y >= boundsY - 0.01f);
+			assert(x + width <= boundsX + boundsWidth + 0.01f && y + height <= boundsY + boundsHeight + 0.01f);
+		}
+	}
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+static void checkGridHits(SkeletonBoundsGrid &grid, Vector<SkeletonBounds *> &bounds, float x1, float y1, float x2, float y2) {
+	Vector<SkeletonBounds *> hits;
+	grid.intersectsSegment(x1, y1, x2, y2, hits);
+	for (size_t i = 0; i < bounds.size(); i++) {
+		bool hit = bounds[i]->aabbintersectsSegment(x1, y1, x2, y2) && bounds[i]->intersectsSegment(x1, y1, x2, y2);
+		assert(hit == hits.contains(bounds[i]));
+		SP_UNUSED(hit);
+	}
+	grid.containsPoint(x1, y1, hits);
+	for (size_t i = 0; i < bounds.size(); i++) {
+		bool hit = bounds[i]->aabbcontainsPoint(x1, y1) && bounds[i]->containsPoint(x1, y1);
+		assert(hit == hits.contains(bounds[i]));
+		SP_UNUSED(hit);
+	}
+}
+
+void testSkeletonBoundsGrid() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing skeleton bounds grid\n");
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	skeleton->setAttachment("head-bb", "head");
+	state->setAnimation(0, "walk", true);
+
+	// Pose one skeleton at different places and times, keeping a SkeletonBounds for each.
+	SkeletonBoundsGrid grid(300);
+	Vector<SkeletonBounds *> bounds;
+	for (int i = 0; i < 40; i++) {
+		state->update(0.1f);
+		state->apply(*skeleton);
+		skeleton->setX((i % 8) * 250.0f);
+		skeleton->setY((i / 8) * 400.0f);
+		skeleton->updateWorldTransform();
+		SkeletonBounds *skeletonBounds = new (__FILE__, __LINE__) SkeletonBounds();
+		skeletonBounds->update(*skeleton, true);
+		bounds.add(skeletonBounds);
+		grid.add(skeletonBounds);
+	}
+	for (int i = 0; i < 200; i++) {
+		float x = (i * 37) % 2000 - 100.0f, y = (i * 53) % 2200 - 100.0f;
+		checkGridHits(grid, bounds, x, y, x + (i % 7) * 150.0f - 450, y + (i % 5) * 200.0f - 400);
+	}
+	Vector<SkeletonBounds *> hits;
+	grid.intersectsBox(-10000, -10000, 10000, 10000, hits);
+	assert(hits.size() == bounds.size());
+
+	// Move some bounds to other cells and remove one.
+	for (size_t i = 0; i < bounds.size(); i += 3) {
+		state->update(0.1f);
+		state->apply(*skeleton);
+		skeleton->setX(i * 40.0f);
+		skeleton->setY(-500);
+		skeleton->updateWorldTransform();
+		bounds[i]->update(*skeleton, true);
+	}
+	grid.update();
+	grid.remove(bounds[1]);
+	delete bounds[1];
+	bounds.removeAt(1);
+	for (int i = 0; i < 200; i++) {
+		float x = (i * 41) % 2000 - 100.0f, y = (i * 29) % 2700 - 600.0f;
+		checkGridHits(grid, bounds, x, y, x + (i % 3) * 300.0f - 300, y + (i % 4) * 100.0f);
+	}
+
+	// Bounds spanning too many cells are kept in a separate list, across updates, removal and shrinking back.
+	skeleton->setScaleX(20);
+	skeleton->setScaleY(20);
+	for (size_t i = 0; i < bounds.size(); i += 5) {
+		skeleton->setX(i * 100.0f);
+		skeleton->updateWorldTransform();
+		bounds[i]->update(*skeleton, true);
+	}
+	for (int i = 0; i < 3; i++) {
+		grid.update();
+		checkGridHits(grid, bounds, i * 500.0f, 300, i * 500.0f + 200, 1500);
+	}
+	grid.remove(bounds[5]);
+	delete bounds[5];
+	bounds.removeAt(5);
+	skeleton->setScaleX(1);
+	skeleton->setScaleY(1);
+	skeleton->updateWorldTransform();
+	bounds[0]->update(*skeleton, true);
+	grid.update();
+	for (int i = 0; i < 200; i++) {
+		float x = (i * 43) % 4000 - 100.0f, y = (i * 31) % 4000 - 600.0f;
+		checkGridHits(grid, bounds, x, y, x + (i % 3) * 300.0f - 300, y + (i % 4) * 100.0f);
+	}
+
+	ContainerUtil::cleanUpVectorOfPointers(bounds);
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+static void checkSkinning(const char *jsonFile, const char *atlasFile, const char *skinName) {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	loadJson(jsonFile, atlasFile, atlas, skeletonData, stateData, skeleton, state);
+	Skin *skin = skinName ? skeletonData->findSkin(skinName) : NULL;
+	if (skin) skeleton->setSkin(skin);
+	SkinningData skinning(*skeletonData, skin);
+
+	Vector<float> palette, positions, expected, actual;
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		skeleton->setToSetupPose();
+		state->setAnimation(0, animations[i], true);
+		for (int frame = 0; frame < 20; frame++) {
+			state->update(0.1f);
+			state->apply(*skeleton);
+			skeleton->updateWorldTransform();
+			SkinningData::computeBonePalette(*skeleton, palette);
+			for (size_t ii = 0; ii < skeleton->getSlots().size(); ii++) {
+				Slot *slot = skeleton->getSlots()[ii];
+				Attachment *attachment = slot->getAttachment();
+				if (!attachment) continue;
+				size_t length;
+				if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+					length = 8;
+					expected.setSize(length, 0);
+					static_cast<RegionAttachment *>(attachment)->computeWorldVertices(*slot, expected, 0, 2);
+				} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+					MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+					length = mesh->getWorldVerticesLength();
+					expected.setSize(length, 0);
+					mesh->computeWorldVertices(*slot, 0, length, expected, 0, 2);
+				} else
+					continue;
+				SkinningAttachment *skinned = skinning.findAttachment(slot->getData().getIndex(), attachment);
+				assert(skinned && skinned->getVertexCount() * 2 == length);
+				bool deformed = skinning.computeDeformedPositions(*slot, *skinned, positions);
+				actual.setSize(length, 0);
+				skinning.computeWorldVertices(*skinned, palette.buffer(), deformed ? positions.buffer() : NULL,
+											  actual.buffer(), 0, 2);
+				for (size_t v = 0; v < length; v++)
+					assert(actual[v] == expected[v]);
+			}
+		}
+	}
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testSkinningData() {
+	printf("Testing skinning data\n");
+	checkSkinning("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", NULL);
+	checkSkinning("testdata/raptor/raptor-pro.json", "testdata/raptor/raptor.atlas", NULL);
+	checkSkinning("testdata/goblins/goblins-pro.json", "testdata/goblins/goblins.atlas", "goblingirl");
+	checkSkinning("testdata/stretchyman/stretchyman-pro.json", "testdata/stretchyman/stretchyman.atlas", NULL);
+	checkSkinning("testdata/tank/tank-pro.json", "testdata/tank/tank.atlas", NULL);
+	checkSkinning("testdata/coin/coin-pro.json", "testdata/coin/coin.atlas", NULL);
+}
+
+struct TestVertex {
+	float x, y;
+	unsigned int color;
+	float u, v;
+};
+
+static void checkRenderer(SkeletonRenderer &renderer, Skeleton *skeleton, SkeletonClipping &clipper) {
+	// Reference output computed per attachment, the way the integrations did before.
+	Vector<float> positions, uvs, worldVertices;
+	Vector<unsigned int> colors;
+	Vector<void *> textures;
+	Vector<size_t> indices;
+	unsigned short quadIndices[] = {0, 1, 2, 2, 3, 0};
+	for (size_t i = 0; i < skeleton->getDrawOrder().size(); i++) {
+		Slot &slot = *skeleton->getDrawOrder()[i];
+		Attachment *attachment = slot.getAttachment();
+		if (!attachment || slot.getColor().a == 0 || !slot.getBone().isActive()) {
+			clipper.clipEnd(slot);
+			continue;
+		}
+		Vector<float> *vertices = &worldVertices, *attachmentUVs;
+		Vector<unsigned short> triangles;
+		Color *color;
+		void *texture;
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+			worldVertices.setSize(8, 0);
+			region->computeWorldVertices(slot, worldVertices, 0, 2);
+			attachmentUVs = &region->getUVs();
+			for (int ii = 0; ii < 6; ii++) triangles.add(quadIndices[ii]);
+			color = &region->getColor();
+			texture = region->getRegion()->rendererObject;
+		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+			MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+			worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+			mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, 2);
+			attachmentUVs = &mesh->getUVs();
+			triangles.addAll(mesh->getTriangles());
+			color = &mesh->getColor();
+			texture = mesh->getRegion()->rendererObject;
+		} else {
+			if (attachment->getRTTI().isExactly(ClippingAttachment::rtti))
+				clipper.clipStart(slot, static_cast<ClippingAttachment *>(attachment));
+			else
+				clipper.clipEnd(slot);
+			continue;
+		}
+		if (clipper.isClipping()) {
+			clipper.clipTriangles(worldVertices, triangles, *attachmentUVs, 2);
+			vertices = &clipper.getClippedVertices();
+			attachmentUVs = &clipper.getClippedUVs();
+			triangles.clear();
+			triangles.addAll(clipper.getClippedTriangles());
+		}
+		size_t first = positions.size() >> 1;
+		positions.addAll(*vertices);
+		uvs.addAll(*attachmentUVs);
+		Color &skeletonColor = skeleton->getColor(), &slotColor = slot.getColor();
+		unsigned char rgba[4] = {(unsigned char) (skeletonColor.r * slotColor.r * color->r * 255),
+								 (unsigned char) (skeletonColor.g * slotColor.g * color->g * 255),
+								 (unsigned char) (skeletonColor.b * slotColor.b * color->b * 255),
+								 (unsigned char) (skeletonColor.a * slotColor.a * color->a * 255)};
+		unsigned int packed;
+		memcpy(&packed, rgba, 4);
+		for (size_t ii = 0; ii < vertices->size() >> 1; ii++) {
+			colors.add(packed);
+			textures.add(texture);
+		}
+		for (size_t ii = 0; ii < triangles.size(); ii++)
+			indices.add(first + triangles[ii]);
+		clipper.clipEnd(slot);
+	}
+	clipper.clipEnd();
+
+	renderer.render(*skeleton);
+	assert(renderer.getVertexCount() == positions.size() >> 1);
+	assert(renderer.getIndices().size() == indices.size());
+	TestVertex *vertices = (TestVertex *) renderer.getVertices();
+	for (size_t i = 0; i < renderer.getVertexCount(); i++) {
+		assert(vertices[i].x == positions[i << 1] && vertices[i].y == positions[(i << 1) + 1]);
+		assert(vertices[i].u == uvs[i << 1] && vertices[i].v == uvs[(i << 1) + 1]);
+		assert(vertices[i].color == colors[i]);
+	}
+	Vector<RenderCommand> &commands = renderer.getCommands();
+	size_t indexCount = 0;
+	for (size_t i = 0; i < commands.size(); i++) {
+		RenderCommand &command = commands[i];
+		assert(command.indexStart == indexCount);
+		indexCount += command.indexCount;
+		for (size_t ii = command.indexStart; ii < command.indexStart + command.indexCount; ii++) {
+			size_t index = command.vertexStart + renderer.getIndices()[ii];
+			assert(index == indices[ii] && index < command.vertexStart + command.vertexCount);
+			assert(textures[index] == command.texture);
+			SP_UNUSED(index);
+		}
+		assert(i == 0 || command.texture != commands[i - 1].texture || command.blendMode != commands[i - 1].blendMode);
+	}
+	assert(indexCount == indices.size());
+	SP_UNUSED(vertices);
+}
+
+void testSkeletonRenderer() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing skeleton renderer\n");
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	SkeletonRenderer renderer(VertexFormat(sizeof(TestVertex), 0, 12, 8));
+	SkeletonClipping clipper;
+	const char *animations[] = {"walk", "portal", "shoot"};
+	for (int i = 0; i < 3; i++) {
+		skeleton->setToSetupPose();
+		state->setAnimation(0, animations[i], true);
+		for (int frame = 0; frame < 30; frame++) {
+			state->update(0.1f);
+			state->apply(*skeleton);
+			skeleton->updateWorldTransform();
+			checkRenderer(renderer, skeleton, clipper);
+		}
+	}
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+static void checkRenderChanged(SkeletonRenderer &renderer, Skeleton *skeleton) {
+	bool changed = renderer.render(*skeleton);
+	assert(changed);
+	changed = renderer.render(*skeleton);
+	assert(!changed);
+	SP_UNUSED(changed);
+}
+
+void testRenderCache() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing render cache\n");
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	SkeletonRenderer renderer(VertexFormat(sizeof(TestVertex), 0, 12, 8));
+	state->setAnimation(0, "walk", true);
+	state->update(0.25f);
+	state->apply(*skeleton);
+	skeleton->updateWorldTransform();
+	checkRenderChanged(renderer, skeleton);
+
+	// Applying the same pose again keeps the output.
+	state->apply(*skeleton);
+	skeleton->updateWorldTransform();
+	bool changed = renderer.render(*skeleton);
+	assert(!changed);
+	SP_UNUSED(changed);
+
+	// Timelines.
+	state->update(0.1f);
+	state->apply(*skeleton);
+	skeleton->updateWorldTransform();
+	checkRenderChanged(renderer, skeleton);
+
+	// Bone, skeleton and constraint transforms.
+	skeleton->findBone("head")->setRotation(skeleton->findBone("head")->getRotation() + 10);
+	skeleton->updateWorldTransform();
+	checkRenderChanged(renderer, skeleton);
+	skeleton->setX(50);
+	skeleton->updateWorldTransform();
+	checkRenderChanged(renderer, skeleton);
+	skeleton->getIkConstraints()[0]->setMix(0.5f);
+	skeleton->updateWorldTransform();
+	checkRenderChanged(renderer, skeleton);
+
+	// Colors.
+	skeleton->getColor().a = 0.5f;
+	checkRenderChanged(renderer, skeleton);
+	Slot *slot = skeleton->findSlot("head");
+	slot->getColor().g = 0.5f;
+	checkRenderChanged(renderer, skeleton);
+	slot->getDarkColor().r = 0.5f;
+	checkRenderChanged(renderer, skeleton);
+
+	// Attachments, sequence index and deform.
+	skeleton->setAttachment("front-fist", "front-fist-open");
+	checkRenderChanged(renderer, skeleton);
+	skeleton->findSlot("front-fist")->setSequenceIndex(1);
+	checkRenderChanged(renderer, skeleton);
+	MeshAttachment *mesh = static_cast<MeshAttachment *>(slot->getAttachment());
+	size_t deformLength = mesh->getBones().size() == 0 ? mesh->getVertices().size() : mesh->getVertices().size() / 3 * 2;
+	slot->getDeform().setSize(deformLength, 0);
+	checkRenderChanged(renderer, skeleton);
+	slot->getDeform()[1] = 5;
+	checkRenderChanged(renderer, skeleton);
+
+	// Draw order and skin.
+	Vector<Slot *> &drawOrder = skeleton->getDrawOrder();
+	Slot *first = drawOrder[20];
+	drawOrder[20] = drawOrder[21];
+	drawOrder[21] = first;
+	checkRenderChanged(renderer, skeleton);
+	skeleton->setSkin(skeletonData->getDefaultSkin());
+	checkRenderChanged(renderer, skeleton);
+
+	// Restoring a pose, explicit changes and renderer settings.
+	SkeletonPose pose;
+	pose.capture(*skeleton);
+	pose.restore(*skeleton);
+	checkRenderChanged(renderer, skeleton);
+	skeleton->markChanged();
+	checkRenderChanged(renderer, skeleton);
+	renderer.setPremultipliedAlpha(true);
+	checkRenderChanged(renderer, skeleton);
+	Skeleton other(skeletonData);
+	other.updateWorldTransform();
+	checkRenderChanged(renderer, &other);
+	checkRenderChanged(renderer, skeleton);
+
+	// A skeleton created at the address of a disposed one starts at the same generation, but is rendered anew.
+	Skeleton *reused = new (__FILE__, __LINE__) Skeleton(skeletonData);
+	reused->updateWorldTransform();
+	checkRenderChanged(renderer, reused);
+	reused->~Skeleton();
+	new (reused) Skeleton(skeletonData);
+	reused->setX(100);
+	reused->updateWorldTransform();
+	checkRenderChanged(renderer, reused);
+	delete reused;
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+static float getDeformKey(DeformTimeline *timeline, size_t frame, size_t vertex) {
+	VertexAttachment *attachment = timeline->getAttachment();
+	if (vertex >= timeline->getStart() && vertex < timeline->getStart() + timeline->getCount())
+		return timeline->getVertices()[frame * timeline->getCount() + vertex - timeline->getStart()];
+	return attachment->getBones().size() == 0 ? attachment->getVertices()[vertex] : 0;
+}
+
+void testDeformTimeline() {
+	Atlas *atlas = NULL, *binaryAtlas = NULL;
+	SkeletonData *skeletonData = NULL, *binaryData = NULL;
+	AnimationStateData *stateData = NULL, *binaryStateData = NULL;
+	Skeleton *skeleton = NULL, *binarySkeleton = NULL;
+	AnimationState *state = NULL, *binaryState = NULL;
+
+	printf("Testing deform timeline\n");
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", binaryAtlas, binaryData,
+			   binaryStateData, binarySkeleton, binaryState);
+
+	// JSON and binary keys expand to the same vertices, JSON setup vertices are rounded.
+	int deformTimelines = 0;
+	for (size_t i = 0; i < skeletonData->getAnimations().size(); i++) {
+		Vector<Timeline *> &timelines = skeletonData->getAnimations()[i]->getTimelines();
+		Vector<Timeline *> &binaryTimelines = binaryData->getAnimations()[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (!timelines[ii]->getRTTI().isExactly(DeformTimeline::rtti)) continue;
+			DeformTimeline *timeline = static_cast<DeformTimeline *>(timelines[ii]);
+			DeformTimeline *binaryTimeline = static_cast<DeformTimeline *>(binaryTimelines[ii]);
+			VertexAttachment *attachment = timeline->getAttachment();
+			size_t vertexCount = attachment->getBones().size() == 0 ? attachment->getVertices().size() : attachment->getVertices().size() / 3 * 2;
+			assert(timeline->getStart() + timeline->getCount() <= vertexCount);
+			assert(timeline->getVertices().size() == timeline->getFrameCount() * timeline->getCount());
+			for (size_t frame = 0; frame < timeline->getFrameCount(); frame++) {
+				for (size_t v = 0; v < vertexCount; v++)
+					assert(MathUtil::abs(getDeformKey(timeline, frame, v) - getDeformKey(binaryTimeline, frame, v)) < 0.01f);
+			}
+			deformTimelines++;
+		}
+	}
+	assert(deformTimelines > 0);
+	SP_UNUSED(deformTimelines);
+
+	// Full length keys are trimmed to the range that differs from the setup pose, which grows as keys are added.
+	Slot *slot = skeleton->findSlot("head");
+	MeshAttachment *mesh = static_cast<MeshAttachment *>(slot->getAttachment());
+	assert(mesh->getBones().size() > 0);
+	size_t vertexCount = mesh->getVertices().size() / 3 * 2;
+	DeformTimeline timeline(3, 0, slot->getData().getIndex(), mesh);
+	Vector<float> vertices;
+	vertices.setSize(vertexCount, 0);
+	timeline.setFrame(0, 0, vertices);
+	assert(timeline.getCount() == 0);
+	vertices[4] = 1;
+	vertices[5] = 2;
+	timeline.setFrame(1, 1, vertices);
+	assert(timeline.getStart() == 4 && timeline.getCount() == 2);
+	vertices[10] = 3;
+	timeline.setFrame(2, 2, vertices);
+	assert(timeline.getStart() == 4 && timeline.getCount() == 7);
+	assert(getDeformKey(&timeline, 1, 5) == 2 && getDeformKey(&timeline, 1, 10) == 0);
+
+	// Keyed vertices are interpolated, the rest stay in the setup pose.
+	Vector<float> &deform = slot->getDeform();
+	deform.setSize(vertexCount, 7);
+	timeline.apply(*skeleton, 0, 1.5f, NULL, 1, MixBlend_Replace, MixDirection_In);
+	assert(deform.size() == vertexCount);
+	assert(deform[4] == 1 && deform[5] == 2 && deform[10] == 1.5f && deform[0] == 0 && deform[vertexCount - 1] == 0);
+	timeline.apply(*skeleton, 0, 2, NULL, 0.5f, MixBlend_Add, MixDirection_In);
+	assert(deform[4] == 1.5f && deform[10] == 3 && deform[11] == 0);
+	SP_UNUSED(deform);
+
+	dispose(binaryAtlas, binaryData, binaryStateData, binarySkeleton, binaryState);
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testQuantizedCurves() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing quantized curves\n");
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			   skeleton, state);
+	SkeletonBinary binary(atlas);
+	binary.setQuantizeCurves(true);
+	SkeletonData *quantizedData = binary.readSkeletonDataFile("testdata/spineboy/spineboy-pro.skel");
+	assert(quantizedData);
+	Skeleton quantizedSkeleton(quantizedData);
+
+	// Only the curve types remain as floats.
+	int quantized = 0;
+	for (size_t i = 0; i < quantizedData->getAnimations().size(); i++) {
+		Vector<Timeline *> &timelines = quantizedData->getAnimations()[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (!timelines[ii]->getRTTI().instanceOf(CurveTimeline::rtti)) continue;
+			CurveTimeline *timeline = static_cast<CurveTimeline *>(timelines[ii]);
+			assert(timeline->getCurves().size() == timeline->getFrameCount());
+			if (timeline->isQuantized()) quantized++;
+		}
+	}
+	assert(quantized > 0);
+	SP_UNUSED(quantized);
+
+	// Poses match closely, including curves with handles outside their frames.
+	for (size_t i = 0; i < skeletonData->getAnimations().size(); i++) {
+		Animation *animation = skeletonData->getAnimations()[i];
+		Animation *quantizedAnimation = quantizedData->getAnimations()[i];
+		for (int frame = 0; frame <= 300; frame++) {
+			float time = animation->getDuration() * frame / 300;
+			animation->apply(*skeleton, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+			quantizedAnimation->apply(quantizedSkeleton, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+			for (size_t ii = 0; ii < skeleton->getBones().size(); ii++) {
+				Bone *bone = skeleton->getBones()[ii], *quantizedBone = quantizedSkeleton.getBones()[ii];
+				assert(MathUtil::abs(bone->getRotation() - quantizedBone->getRotation()) < 0.05f);
+				assert(MathUtil::abs(bone->getX() - quantizedBone->getX()) < 0.05f);
+				assert(MathUtil::abs(bone->getY() - quantizedBone->getY()) < 0.05f);
+				assert(MathUtil::abs(bone->getScaleX() - quantizedBone->getScaleX()) < 0.001f);
+				SP_UNUSED(bone);
+				SP_UNUSED(quantizedBone);
+			}
+		}
+	}
+
+	delete quantizedData;
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+class CountingTimeline : public Timeline {
+	RTTI_DECL
+
+public:
+	CountingTimeline() : Timeline(1, 1), applied(0) {
+	}
+
+	virtual void apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
+					   MixBlend blend, MixDirection direction) {
+		SP_UNUSED(skeleton);
+		SP_UNUSED(lastTime);
+		SP_UNUSED(time);
+		SP_UNUSED(pEvents);
+		SP_UNUSED(alpha);
+		SP_UNUSED(blend);
+		SP_UNUSED(direction);
+		applied++;
+	}
+
+	int applied;
+};
+
+RTTI_IMPL(CountingTimeline, Timeline)
+
+void testTimelineGroups() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing timeline groups\n");
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	Skeleton reference(skeletonData);
+
+	Vector<float> pose, referencePose;
+	for (size_t i = 0; i < skeletonData->getAnimations().size(); i++) {
+		Animation *animation = skeletonData->getAnimations()[i];
+		Vector<Timeline *> &timelines = animation->getTimelines();
+		Vector<Timeline *> &grouped = animation->getGroupedTimelines();
+		Vector<TimelineGroup> &groups = animation->getTimelineGroups();
+
+		// Every timeline is in exactly one group, and there is one group per type.
+		assert(grouped.size() == timelines.size());
+		size_t next = 0;
+		for (size_t ii = 0; ii < groups.size(); ii++) {
+			assert(groups[ii].start == next);
+			assert(ii == 0 || groups[ii].type > groups[ii - 1].type);
+			next += groups[ii].count;
+		}
+		assert(next == timelines.size());
+		for (size_t ii = 0; ii < grouped.size(); ii++)
+			assert(timelines[animation->getGroupedIndices()[ii]] == grouped[ii]);
+
+		// Applying by group gives the same pose as applying in the original order.
+		for (int frame = 0; frame <= 10; frame++) {
+			float time = animation->getDuration() * frame / 10;
+			skeleton->setToSetupPose();
+			reference.setToSetupPose();
+			animation->apply(*skeleton, 0, time, false, NULL, 0.7f, MixBlend_Setup, MixDirection_In);
+			for (size_t ii = 0; ii < timelines.size(); ii++)
+				timelines[ii]->apply(reference, 0, time, NULL, 0.7f, MixBlend_Setup, MixDirection_In);
+			skeleton->updateWorldTransform();
+			reference.updateWorldTransform();
+			pose.clear();
+			referencePose.clear();
+			recordPose(skeleton, pose);
+			recordPose(&reference, referencePose);
+			assert(pose.size() == referencePose.size());
+			assert(memcmp(pose.buffer(), referencePose.buffer(), pose.size() * sizeof(float)) == 0);
+		}
+	}
+
+	// An unknown timeline type keeps the original order.
+	Animation *animation = skeletonData->findAnimation("walk");
+	CountingTimeline *counting = new (__FILE__, __LINE__) CountingTimeline();
+	animation->getTimelines().add(counting);
+	animation->getTimelines().add(animation->getTimelines()[0]);
+	animation->getTimelines().removeAt(0);
+	animation->groupTimelines();
+	Vector<TimelineGroup> &groups = animation->getTimelineGroups();
+	assert(groups[groups.size() - 2].type == TimelineType_Other);
+	for (size_t i = 0; i < animation->getTimelines().size(); i++)
+		assert(animation->getGroupedIndices()[i] == (int) i);
+	state->setAnimation(0, animation, true);
+	state->update(0.1f);
+	state->apply(*skeleton);
+	assert(counting->applied == 1);
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+static void recordWorldVertices(Skeleton *skeleton, Vector<float> &vertices) {
+	Vector<float> worldVertices;
+	vertices.clear();
+	for (size_t i = 0; i < skeleton->getBones().size(); i++) {
+		vertices.add(skeleton->getBones()[i]->getWorldX());
+		vertices.add(skeleton->getBones()[i]->getWorldY());
+	}
+	for (size_t i = 0; i < skeleton->getSlots().size(); i++) {
+		Slot *slot = skeleton->getSlots()[i];
+		Attachment *attachment = slot->getAttachment();
+		if (!attachment || !slot->getBone().isActive()) continue;
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			worldVertices.setSize(8, 0);
+			static_cast<RegionAttachment *>(attachment)->computeWorldVertices(*slot, worldVertices, 0, 2);
+		} else if (attachment->getRTTI().instanceOf(VertexAttachment::rtti)) {
+			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
+			worldVertices.setSize(vertexAttachment->getWorldVerticesLength(), 0);
+			vertexAttachment->computeWorldVertices(*slot, 0, worldVertices.size(), worldVertices, 0, 2);
+		} else
+			continue;
+		for (size_t ii = 0; ii < worldVertices.size(); ii++)
+			vertices.add(worldVertices[ii]);
+	}
+}
+
+void testDataScale() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing data scale\n");
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	SkeletonJson json(atlas);
+	json.setScale(0.5f);
+	SkeletonData *scaledData = json.readSkeletonDataFile("testdata/spineboy/spineboy-pro.json");
+	assert(scaledData);
+	Skeleton scaledSkeleton(scaledData);
+	AnimationStateData scaledStateData(scaledData);
+	AnimationState scaledState(&scaledStateData);
+
+	// The data scale matches scaling at load time, including IK and flipping the skeleton.
+	skeleton->setDataScale(0.5f);
+	skeleton->setScaleX(-1);
+	scaledSkeleton.setScaleX(-1);
+	state->setAnimation(0, "walk", true);
+	state->setAnimation(1, "aim", true);
+	scaledState.setAnimation(0, "walk", true);
+	scaledState.setAnimation(1, "aim", true);
+	Vector<float> vertices, scaledVertices;
+	for (int i = 0; i < 30; i++) {
+		state->update(1 / 30.0f);
+		state->apply(*skeleton);
+		skeleton->updateWorldTransform();
+		scaledState.update(1 / 30.0f);
+		scaledState.apply(scaledSkeleton);
+		scaledSkeleton.updateWorldTransform();
+		recordWorldVertices(skeleton, vertices);
+		recordWorldVertices(&scaledSkeleton, scaledVertices);
+		assert(vertices.size() == scaledVertices.size());
+		for (size_t ii = 0; ii < vertices.size(); ii++)
+			assert(MathUtil::abs(vertices[ii] - scaledVertices[ii]) < 0.01f);
+	}
+
+	delete scaledData;
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testCopyOnWriteSkins() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing copy on write skins\n");
+	loadJson("testdata/goblins/goblins-pro.json", "testdata/goblins/goblins.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	Skin *source = skeletonData->findSkin("goblin");
+	assert(source);
+
+	// Shared skins share the source attachments.
+	Skin *copy = new (__FILE__, __LINE__) Skin("copy");
+	copy->shareSkin(source);
+	size_t count = 0;
+	Skin::AttachmentMap::Entries entries = source->getAttachments();
+	while (entries.hasNext()) {
+		Skin::AttachmentMap::Entry &entry = entries.next();
+		assert(copy->getAttachment(entry._slotIndex, entry._name) == entry._attachment);
+		count++;
+	}
+	assert(count > 0);
+
+	// Writing a region or mesh in the copy gives the copy its own attachment and leaves the source unchanged.
+	int slotIndex = skeletonData->findSlot("eyes")->getIndex();
+	Attachment *eyes = source->getAttachment(slotIndex, "eyes-closed");
+	assert(eyes && eyes->getRTTI().isExactly(RegionAttachment::rtti));
+	RegionAttachment *writable = static_cast<RegionAttachment *>(copy->getWritableAttachment(slotIndex, "eyes-closed"));
+	assert(writable != eyes);
+	assert(copy->getAttachment(slotIndex, "eyes-closed") == writable);
+	assert(copy->getWritableAttachment(slotIndex, "eyes-closed") == writable);
+	writable->getColor().set(1, 0, 0, 1);
+	assert(static_cast<RegionAttachment *>(eyes)->getColor().g == 1);
+
+	slotIndex = skeletonData->findSlot("left-foot")->getIndex();
+	Attachment *foot = source->getAttachment(slotIndex, "left-foot");
+	assert(foot && foot->getRTTI().isExactly(MeshAttachment::rtti));
+	Attachment *writableFoot = copy->getWritableAttachment(slotIndex, "left-foot");
+	assert(writableFoot != foot && writableFoot->getRTTI().isExactly(MeshAttachment::rtti));
+	assert(static_cast<MeshAttachment *>(writableFoot)->getParentMesh() == foot);
+
+	// Sharing leaves the source unmodified, so its attachments are not copied when written.
+	slotIndex = skeletonData->findSlot("torso")->getIndex();
+	Attachment *torso = source->getAttachment(slotIndex, "torso");
+	assert(source->getWritableAttachment(slotIndex, "torso") == torso);
+	Skin::AttachmentMap::Entries sourceEntries = source->getAttachments();
+	while (sourceEntries.hasNext())
+		assert(!sourceEntries.next()._copyOnWrite);
+	Attachment *writableTorso = copy->getWritableAttachment(slotIndex, "torso");
+	assert(writableTorso != torso && copy->getAttachment(slotIndex, "torso") == writableTorso);
+	assert(!copy->getWritableAttachment(slotIndex, "missing"));
+	SP_UNUSED(writableTorso);
+
+	// Copied skins get their own attachments.
+	Skin *deepCopy = new (__FILE__, __LINE__) Skin("deep copy");
+	deepCopy->copySkin(source);
+	assert(deepCopy->getAttachment(slotIndex, "torso") != torso);
+	assert(deepCopy->getWritableAttachment(slotIndex, "torso") == deepCopy->getAttachment(slotIndex, "torso"));
+
+	delete deepCopy;
+	delete copy;
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testJson() {
+	printf("Testing JSON\n");
+	Json *json = new (__FILE__, __LINE__) Json("{\"a\": [1, 2, 3], \"b\": true}");
+	Json *a = Json::getItem(json, "a");
+	assert(a && Json::getItem(a, 2) && !Json::getItem(a, 3) && !Json::getItem(a, -1));
+	assert(Json::getItem(json, 1) == Json::getItem(json, "b"));
+	delete json;
+
+	// Children of arrays and objects left incomplete by malformed input are still reachable by index.
+	const char *malformed[] = {"[1, 2, ", "[1, 2 3]", "{\"a\": 1, \"b\": 2", "{\"a\": [1, {\"b\": }]}"};
+	for (int i = 0; i < 4; i++) {
+		json = new (__FILE__, __LINE__) Json(malformed[i]);
+		int count = 0;
+		for (Json *child = Json::getItem(json, 0); child; child = Json::getItem(json, ++count))
+			Json::getItem(child, 1);
+		assert(!Json::getItem(json, count + 1));
+		delete json;
+	}
+}
+
+void testAtlasRegions() {
+	printf("Testing atlas regions\n");
+	Atlas *atlas = new (__FILE__, __LINE__) Atlas("testdata/spineboy/spineboy.atlas", NULL);
+	Vector<AtlasRegion *> &regions = atlas->getRegions();
+	assert(regions.size() > 4);
+	for (size_t i = 0; i < regions.size(); i++)
+		assert(atlas->findRegion(regions[i]->name) == regions[i]);
+	assert(!atlas->findRegion("missing"));
+
+	// Lookups stay correct when the regions are changed without rebuilding the index.
+	String lastName = regions[regions.size() - 1]->name;
+	for (int i = 0; i < 3; i++) {
+		delete regions[regions.size() - 1];
+		regions.removeAt(regions.size() - 1);
+	}
+	assert(!atlas->findRegion(lastName));
+	assert(atlas->findRegion(regions[0]->name) == regions[0]);
+	AtlasRegion *added = new (__FILE__, __LINE__) AtlasRegion();
+	added->name = "added";
+	added->page = regions[0]->page;
+	regions.add(added);
+	assert(atlas->findRegion("added") == added);
+	atlas->indexRegions();
+	assert(atlas->findRegion("added") == added && !atlas->findRegion(lastName));
+	SP_UNUSED(added);
+
+	delete atlas;
+}
+
+void testVector() {
+	printf("Testing vector\n");
+
+	// Trivially copyable elements are filled, copied and removed in bulk.
+	Vector<float> floats;
+	floats.setSize(4, 0);
+	floats.setSize(6, 2);
+	assert(floats[3] == 0 && floats[4] == 2 && floats[5] == 2);
+	floats.addAll(floats);
+	assert(floats.size() == 12 && floats[10] == 2 && floats[9] == 0);
+	floats[1] = 1;
+	floats.removeAt(0);
+	assert(floats.size() == 11 && floats[0] == 1 && floats[4] == 2);
+	Vector<float> floatsCopy(floats);
+	assert(floatsCopy == floats);
+
+	// Moving takes the buffer.
+	float *buffer = floats.buffer();
+	Vector<float> moved(std::move(floats));
+	assert(moved.buffer() == buffer && moved.size() == 11);
+	assert(floats.size() == 0 && floats.buffer() == NULL);
+	floats = std::move(moved);
+	assert(floats.buffer() == buffer && moved.buffer() == NULL);
+	moved = floats;
+	assert(moved == floats && moved.buffer() != buffer);
+
+	// Other elements are copied and destroyed one at a time.
+	Vector<String> strings;
+	strings.add("a");
+	strings.add("b");
+	strings.add("c");
+	strings.removeAt(1);
+	assert(strings.size() == 2 && strings[0] == "a" && strings[1] == "c");
+	Vector<String> stringsCopy;
+	stringsCopy = strings;
+	stringsCopy.addAll(strings);
+	assert(stringsCopy.size() == 4 && stringsCopy[3] == "c");
+	assert(stringsCopy[0].buffer() != strings[0].buffer());
+}
+
+void testString() {
+	printf("Testing string\n");
+
+	// Strings grow from inline to allocated characters.
+	String empty;
+	assert(empty.buffer() == NULL && empty.isEmpty());
+	String path("short");
+	path.append(path);
+	assert(path == "shortshort" && path.length() == 10);
+	path.append("/much-longer");
+	assert(path == "shortshort/much-longer" && path.length() == 22);
+	String moved(std::move(path));
+	assert(path.buffer() == NULL && moved == "shortshort/much-longer");
+	assert(moved != "shortshort/much-longer/");
+
+	// Interned strings share their characters and are freed with the last string using them.
+	String::setInterning(true);
+	{
+		String a("left-upper-arm-bracer");
+		String b(String("left-upper-arm-bracer"));
+		String c;
+		c = a;
+		assert(a.isInterned() && a.buffer() == b.buffer() && a.buffer() == c.buffer());
+		assert(a == b && String::getInternedCount() == 1);
+		c.append("-2");
+		assert(!c.isInterned() && c != a && String::getInternedCount() == 1);
+		String inlined("head");
+		assert(!inlined.isInterned());
+	}
+	assert(String::getInternedCount() == 0);
+
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData,
+			   stateData, skeleton, state);
+	SkeletonData *otherData = SkeletonJson(atlas).readSkeletonDataFile("testdata/spineboy/spineboy-pro.json");
+	String::setInterning(false);
+	assert(String::getInternedCount() > 0);
+	BoneData *bone = skeletonData->findBone("front-foot-target");
+	assert(bone && bone->getName().isInterned());
+	assert(bone->getName().buffer() == otherData->findBone("front-foot-target")->getName().buffer());
+	delete otherData;
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+	assert(String::getInternedCount() == 0);
+}
+
+void testPool() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing pool\n");
+	Pool<Vector<float> > pool;
+	pool.preallocate(4);
+	assert(pool.getFreeCount() == 4);
+	Vector<float> *a = pool.obtain(), *b = pool.obtain();
+	assert(a != b && pool.getFreeCount() == 2);
+	a->add(1);
+	pool.free(a);
+	// The last freed object is obtained first, unchanged.
+	assert(pool.obtain() == a && a->size() == 1);
+	pool.free(a);
+	pool.free(b);
+	assert(pool.getFreeCount() == 4);
+	// Obtained objects can be deleted instead of freed.
+	delete pool.obtain();
+	assert(pool.getFreeCount() == 3);
+
+	// Track entries are recycled while animations are set and queued.
+	loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData,
+			 skeleton, state);
+	state->preallocateTrackEntries(8);
+	for (int i = 0; i < 100; i++) {
+		state->setAnimation(0, i % 2 ? "walk" : "run", false);
+		state->addAnimation(0, "jump", false, 0);
+		state->addEmptyAnimation(1, 0.1f, 0);
+		state->update(1 / 60.0f);
+		state->apply(*skeleton);
+	}
+	state->clearTracks();
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+// Counts allocations so a thread can check it freed everything it allocated with its own extension.
+class ThreadExtension : public DefaultSpineExtension {
+public:
+	ThreadExtension() : allocations(0), frees(0) {}
+
+	int allocations, frees;
+
+protected:
+	virtual void *_alloc(size_t size, const char *file, int line) override {
+		allocations++;
+		return DefaultSpineExtension::_alloc(size, file, line);
+	}
+
+	virtual void *_calloc(size_t size, const char *file, int line) override {
+		allocations++;
+		return DefaultSpineExtension::_calloc(size, file, line);
+	}
+
+	virtual void *_realloc(void *ptr, size_t size, const char *file, int line) override {
+		if (!ptr) allocations++;
+		return DefaultSpineExtension::_realloc(ptr, size, file, line);
+	}
+
+	virtual void _free(void *mem, const char *file, int line) override {
+		if (mem) frees++;
+		DefaultSpineExtension::_free(mem, file, line);
+	}
+};
+
+static void runThread(SkeletonData *sharedData, AnimationStateData *sharedStateData, int index) {
+	ThreadExtension extension;
+	{
+		SpineExtensionScope scope(&extension);
+
+		// Data loaded on this thread.
+		Atlas *atlas = new (__FILE__, __LINE__) Atlas("testdata/spineboy/spineboy.atlas", NULL);
+		SkeletonBinary binary(atlas);
+		SkeletonData *skeletonData = binary.readSkeletonDataFile("testdata/spineboy/spineboy-pro.skel");
+		assert(skeletonData);
+		AnimationStateData *stateData = new (__FILE__, __LINE__) AnimationStateData(skeletonData);
+
+		// Skeletons using both the shared and the thread's own data.
+		const char *animations[] = {"walk", "run", "jump", "shoot"};
+		Vector<Skeleton *> skeletons;
+		Vector<AnimationState *> states;
+		for (int i = 0; i < 8; i++) {
+			bool shared = i % 2 == 0;
+			Skeleton *skeleton = new (__FILE__, __LINE__) Skeleton(shared ? sharedData : skeletonData);
+			AnimationState *state = new (__FILE__, __LINE__) AnimationState(shared ? sharedStateData : stateData);
+			state->setAnimation(0, animations[(index + i) % 4], true);
+			state->addAnimation(1, animations[(index + i + 1) % 4], false, 0.2f);
+			skeletons.add(skeleton);
+			states.add(state);
+		}
+		for (int frame = 0; frame < 60; frame++) {
+			for (size_t i = 0; i < skeletons.size(); i++) {
+				states[i]->update(1 / 60.0f);
+				states[i]->apply(*skeletons[i]);
+				skeletons[i]->updateWorldTransform();
+			}
+		}
+		for (size_t i = 0; i < skeletons.size(); i++) {
+			delete states[i];
+			delete skeletons[i];
+		}
+		skeletons.clear();
+		states.clear();
+		delete stateData;
+		delete skeletonData;
+		delete atlas;
+	}
+	assert(extension.allocations > 0);
+	assert(extension.allocations == extension.frees);
+}
+
+void testThreads() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing threads\n");
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData,
+			   stateData, skeleton, state);
+#ifndef SPINE_NO_THREADS
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 8; i++)
+		threads.push_back(std::thread(runThread, skeletonData, stateData, i));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+#else
+	// The thread extension is a plain global, so the thread bodies run one after another.
+	for (int i = 0; i < 8; i++)
+		runThread(skeletonData, stateData, i);
+#endif
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testProfiler() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+
+	printf("Testing profiler\n");
+	ProfilerExtension profiler(SpineExtension::getInstance());
+	{
+		SpineExtensionScope scope(&profiler);
+		loadJson("testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas", atlas, skeletonData,
+				 stateData, skeleton, state);
+		assert(profiler.getAllocations() > 0 && profiler.getSiteCount() > 0);
+		assert(profiler.getPeakLiveBytes() >= profiler.getLiveBytes());
+		assert(profiler.getUntrackedFrees() == 0);
+
+		// Only frames that set animations allocate once the skeleton is running.
+		profiler.reset();
+		for (int i = 0; i < 60; i++) {
+			if (i % 20 == 0) state->setAnimation(0, i % 40 ? "walk" : "run", true);
+			state->update(1 / 60.0f);
+			state->apply(*skeleton);
+			skeleton->updateWorldTransform();
+			profiler.endFrame();
+		}
+		assert(profiler.getFrameCount() == 60);
+		size_t frames = 0;
+		for (int i = 0; i < ProfilerExtension::FrameBuckets; i++)
+			frames += profiler.getFrameHistogram(i);
+		assert(frames == 60);
+		assert(profiler.getFrameHistogram(0) > 0 && profiler.getFrameHistogram(0) < 60);
+		for (size_t i = 0; i < profiler.getSiteCount(); i++)
+			assert(profiler.getSite(i).frames <= 3);
+
+		// The dump is valid JSON.
+		FILE *file = tmpfile();
+		assert(file);
+		profiler.dump(file);
+		long length = ftell(file);
+		rewind(file);
+		char *chars = SpineExtension::alloc<char>(length + 1, __FILE__, __LINE__);
+		size_t read = fread(chars, 1, length, file);
+		assert(read == (size_t) length);
+		chars[length] = 0;
+		fclose(file);
+		Json *json = new (__FILE__, __LINE__) Json(chars);
+		assert(Json::getInt(json, "frames", 0) == 60);
+		Json *site = Json::getItem(Json::getItem(json, "sites"), 0);
+		assert(site && Json::getString(site, "file", NULL) && Json::getInt(site, "line", 0) > 0);
+		delete json;
+		SpineExtension::free(chars, __FILE__, __LINE__);
+
+		dispose(atlas, skeletonData, stateData, skeleton, state);
+	}
+	assert(profiler.getLiveCount() == 0 && profiler.getLiveBytes() == 0);
+	assert(profiler.getUntrackedFrees() == 0);
+}
+
+#ifndef SPINE_NO_THREADS
+// Records the threads textures are created on.
+class ThreadTextureLoader : public TextureLoader {
+public:
+	ThreadTextureLoader() : loads(0), unloads(0) {}
+
+	std::thread::id thread;
+	int loads, unloads;
+
+	virtual void load(AtlasPage &page, const String &path) override {
+		SP_UNUSED(path);
+		thread = std::this_thread::get_id();
+		page.texture = &page;
+		loads++;
+	}
+
+	virtual void unload(void *texture) override {
+		SP_UNUSED(texture);
+		unloads++;
+	}
+};
+
+struct AsyncResult {
+	int id;
+	Atlas *atlas;
+	SkeletonData *skeletonData;
+	String error;
+};
+
+static void asyncLoaded(int id, Atlas *atlas, SkeletonData *skeletonData, const String &error, void *userData) {
+	Vector<AsyncResult> &results = *(Vector<AsyncResult> *) userData;
+	AsyncResult result;
+	result.id = id;
+	result.atlas = atlas;
+	result.skeletonData = skeletonData;
+	result.error = error;
+	results.add(result);
+}
+
+void testAsyncLoader() {
+	printf("Testing async loader\n");
+	// The debug extension is not thread safe.
+	SpineExtension *debug = SpineExtension::getInstance();
+	DefaultSpineExtension extension;
+	SpineExtension::setInstance(&extension);
+	{
+		ThreadTextureLoader textureLoader;
+		Vector<AsyncResult> results;
+		{
+			AsyncLoader loader(&textureLoader, 2);
+			int spineboy = loader.load("testdata/spineboy/spineboy.atlas", "testdata/spineboy/spineboy-pro.skel",
+									   asyncLoaded, &results);
+			int raptor = loader.load("testdata/raptor/raptor.atlas", "testdata/raptor/raptor-pro.json", asyncLoaded,
+									 &results, 0.5f);
+			int goblins = loader.load("testdata/goblins/goblins.atlas", "testdata/goblins/goblins-pro.skel",
+									  asyncLoaded, &results);
+			int missing = loader.load("testdata/spineboy/spineboy.atlas", "testdata/missing.json", asyncLoaded,
+									  &results);
+			assert(loader.cancel(goblins));
+			assert(!loader.cancel(goblins));
+			while (loader.getPendingCount() > 0) {
+				loader.update();
+				std::this_thread::yield();
+			}
+			assert(results.size() == 3);
+			for (size_t i = 0; i < results.size(); i++) {
+				AsyncResult &result = results[i];
+				assert(result.id != goblins);
+				if (result.id == missing) {
+					assert(!result.atlas && !result.skeletonData && !result.error.isEmpty());
+					continue;
+				}
+				assert(result.id == spineboy || result.id == raptor);
+				assert(result.atlas && result.skeletonData && result.error.isEmpty());
+				Vector<AtlasRegion *> &regions = result.atlas->getRegions();
+				for (size_t ii = 0; ii < regions.size(); ii++)
+					assert(regions[ii]->rendererObject);
+			}
+			assert(textureLoader.loads > 0 && textureLoader.thread == std::this_thread::get_id());
+
+			// Loads still queued when the loader is destroyed are disposed.
+			loader.load("testdata/goblins/goblins.atlas", "testdata/goblins/goblins-pro.json", asyncLoaded, &results);
+		}
+		assert(results.size() == 3);
+		for (size_t i = 0; i < results.size(); i++) {
+			delete results[i].skeletonData;
+			delete results[i].atlas;
+		}
+		assert(textureLoader.unloads == textureLoader.loads);
+	}
+	SpineExtension::setInstance(debug);
+}
+
+static void checkUpdatePool(UpdatePool &pool, const char *skeletonFile, const char *atlasFile, bool changeTracking) {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+	loadBinary(skeletonFile, atlasFile, atlas, skeletonData, stateData, skeleton, state);
+	Skeleton *parallel = new (__FILE__, __LINE__) Skeleton(skeletonData);
+	AnimationState *parallelState = new (__FILE__, __LINE__) AnimationState(stateData);
+	parallel->setUpdatePool(&pool);
+	skeleton->setChangeTracking(changeTracking);
+	parallel->setChangeTracking(changeTracking);
+
+	// Each animation, mixed from the previous one and with the next one on a second track, gives the same pose.
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	Vector<float> expected, actual;
+	for (size_t i = 0; i < animations.size(); i++) {
+		Animation *animation = animations[i], *next = animations[(i + 1) % animations.size()];
+		state->setAnimation(0, animation, true);
+		state->setAnimation(1, next, true)->setAlpha(0.5f);
+		parallelState->setAnimation(0, animation, true);
+		parallelState->setAnimation(1, next, true)->setAlpha(0.5f);
+		expected.clear();
+		actual.clear();
+		replay(skeleton, state, 20, expected);
+		replay(parallel, parallelState, 20, actual);
+		assert(expected.size() == actual.size());
+		assert(memcmp(expected.buffer(), actual.buffer(), expected.size() * sizeof(float)) == 0);
+	}
+
+	delete parallelState;
+	delete parallel;
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testUpdatePool() {
+	printf("Testing update pool\n");
+	// Splitting levels with a single updatable per thread exercises the stages more than real use would.
+	UpdatePool pool(4, 1);
+	const char *skeletons[][2] = {{"testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas"},
+								  {"testdata/raptor/raptor-pro.skel", "testdata/raptor/raptor.atlas"},
+								  {"testdata/goblins/goblins-pro.skel", "testdata/goblins/goblins.atlas"},
+								  {"testdata/tank/tank-pro.skel", "testdata/tank/tank.atlas"},
+								  {"testdata/stretchyman/stretchyman-pro.skel", "testdata/stretchyman/stretchyman.atlas"}};
+	for (int i = 0; i < 5; i++) {
+		checkUpdatePool(pool, skeletons[i][0], skeletons[i][1], false);
+		checkUpdatePool(pool, skeletons[i][0], skeletons[i][1], true);
+	}
+}
+#endif
+
 namespace spine {
 	SpineExtension *getDefaultExtension() {
 		return new DefaultSpineExtension();
@@ -107,10 +1569,35 @@ namespace spine {
 int main(int argc, char **argv) {
 	SP_UNUSED(argc);
 	SP_UNUSED(argv);
-	DebugExtension debug(SpineExtension::getInstance());
+	// Static, so it outlives statics destroyed after main() returns, like AnimationState::getEmptyAnimation().
+	static DebugExtension debug(SpineExtension::getInstance());
 	SpineExtension::setInstance(&debug);
 
 	testLoading();
+	testPoseSnapshot();
+	testSkinUpdateCaches();
+	testChangeTracking();
+	testEstimatedBounds();
+	testSkeletonBoundsGrid();
+	testSkinningData();
+	testSkeletonRenderer();
+	testRenderCache();
+	testDeformTimeline();
+	testQuantizedCurves();
+	testTimelineGroups();
+	testDataScale();
+	testCopyOnWriteSkins();
+	testJson();
+	testAtlasRegions();
+	testVector();
+	testString();
+	testPool();
+	testThreads();
+	testProfiler();
+#ifndef SPINE_NO_THREADS
+	testAsyncLoader();
+	testUpdatePool();
+#endif
 
 	debug.reportLeaks();
 }
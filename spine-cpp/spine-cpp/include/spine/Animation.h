@@ -37,6 +37,7 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <spine/Property.h>
+#include <spine/TimelineType.h>
 
 namespace spine {
 	class Timeline;
@@ -47,6 +48,13 @@ namespace spine {
 
 	class AnimationState;
 
+	/// A run of timelines of the same concrete type in Animation::getGroupedTimelines().
+	struct SP_API TimelineGroup {
+		TimelineType type;
+		size_t start;
+		size_t count;
+	};
+
 	class SP_API Animation : public SpineObject {
 		friend class AnimationState;
 
@@ -110,6 +118,24 @@ namespace spine {
 
 		Vector<Timeline *> &getTimelines();
 
+		/// Groups the timelines by concrete type, so they can be applied type by type with non-virtual calls. Called by
+		/// the constructor, must be called again if the timelines are changed afterwards.
+		///
+		/// When all timelines are of types known to the runtime, they are sorted by TimelineType, keeping the order of
+		/// timelines of the same type. This gives the same result as applying them in their original order, as each
+		/// property is keyed by a single timeline and a timeline only depends on timelines of an earlier type, e.g.
+		/// deform timelines on the attachment set by an attachment timeline. Otherwise the original order is kept and only
+		/// consecutive timelines of the same type are grouped.
+		void groupTimelines();
+
+		/// The timelines ordered by group, see groupTimelines().
+		Vector<Timeline *> &getGroupedTimelines();
+
+		/// The index in getTimelines() of each timeline in getGroupedTimelines().
+		Vector<int> &getGroupedIndices();
+
+		Vector<TimelineGroup> &getTimelineGroups();
+
 		bool hasTimeline(Vector<PropertyId> &ids);
 
 		float getDuration();
@@ -120,11 +146,23 @@ namespace spine {
 		static int search(Vector<float> &values, float target);
 
 		static int search(Vector<float> &values, float target, int step);
+
 	private:
 		Vector<Timeline *> _timelines;
+		Vector<TimelineType> _timelineTypes;
+		Vector<Timeline *> _groupedTimelines;
+		Vector<int> _groupedIndices;
+		Vector<TimelineGroup> _timelineGroups;
 		HashMap<PropertyId, bool> _timelineIds;
 		float _duration;
 		String _name;
+
+		void addGroupedTimeline(size_t index);
+
+		/// Applies the timelines of a group without virtual calls. If not NULL, alphas and blends are indexed by the
+		/// timeline's index in getTimelines() and override alpha and blend.
+		void applyGroup(TimelineGroup &group, Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents,
+						float alpha, const float *alphas, MixBlend blend, const MixBlend *blends, MixDirection direction);
 	};
 }
 
@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_AnimationBounds_h
+#define Spine_AnimationBounds_h
+
+#include <spine/Vector.h>
+
+namespace spine {
+	class SkeletonData;
+
+	class Skin;
+
+	class Animation;
+
+	/// Stores sampled skeleton space bounds for each animation of a SkeletonData with a skin, so the bounds of a skeleton
+	/// can be estimated without computing world vertices. See Skeleton::getEstimatedBounds().
+	///
+	/// Each animation is split into segments of equal duration. The skeleton is posed at the animation's key frame times and at
+	/// regular samples. Between two samples, the skeleton is assumed to stay within the bounds of both, expanded on each side by
+	/// how far that side moved between them. A segment stores the union of those bounds for the samples that overlap it.
+	///
+	/// The bounds are approximate, not an upper bound, so they must not be used to skip updating or rendering a skeleton
+	/// that may be visible. They hold for a single animation applied over the setup pose when its curves don't overshoot
+	/// between samples. Mixing between animations interpolates rotations, and animations on
+	/// several tracks combine their poses, both of which can exceed the union of the animations' bounds. The bounds are
+	/// computed with a skeleton scale of 1, so bones that don't inherit scale or reflection can also make non-uniform
+	/// skeleton scales exceed them. setPadding() adds a margin for these cases.
+	class SP_API AnimationBounds : public SpineObject {
+	public:
+		/// Samples every animation of the skeleton data. This poses the skeleton once per sample, so it is meant to be done
+		/// when loading.
+		/// @param skin May be NULL to use only the default skin.
+		/// @param sampleInterval The time in seconds between samples, in addition to the key frame times.
+		/// @param segmentDuration The time in seconds of an animation covered by each stored AABB.
+		AnimationBounds(SkeletonData *skeletonData, Skin *skin = NULL, float sampleInterval = 1.0f / 30,
+						float segmentDuration = 0.25f);
+
+		~AnimationBounds();
+
+		/// Computes the AABB of the animation at the specified time, in skeleton space with the skeleton at 0,0 and a scale of
+		/// 1, expanded by the padding.
+		/// @param time The animation time, between 0 and the animation's duration.
+		/// @return False if the animation was not sampled by this instance. Bounds of an animation without attachments are
+		/// empty, with a width and height of 0.
+		bool getBounds(Animation *animation, float time, float &outX, float &outY, float &outWidth, float &outHeight);
+
+		/// Computes the AABB of the setup pose, in the same space as getBounds().
+		void getSetupBounds(float &outX, float &outY, float &outWidth, float &outHeight);
+
+		SkeletonData *getSkeletonData();
+
+		Skin *getSkin();
+
+		float getSegmentDuration();
+
+		/// The distance the bounds are expanded on each side. Default is 0.
+		float getPadding();
+
+		void setPadding(float inValue);
+
+	private:
+		friend class Skeleton;
+
+		struct Entry {
+			Animation *animation;
+			size_t offset;
+			size_t segmentCount;
+		};
+
+		SkeletonData *_skeletonData;
+		Skin *_skin;
+		float _segmentDuration;
+		float _padding;
+		Vector<Entry> _entries;
+		Vector<float> _bounds;
+		float _setupBounds[4];
+
+		/// Finds the min x, min y, max x and max y of the animation at the time, without padding.
+		bool findBounds(Animation *animation, float time, const float *&outBounds);
+
+		void toBounds(const float *bounds, float &outX, float &outY, float &outWidth, float &outHeight);
+	};
+}
+
+#endif /* Spine_AnimationBounds_h */
@@ -94,6 +94,8 @@ namespace spine {
 
 		friend class AnimationState;
 
+		friend class SkeletonPose;
+
 	public:
 		TrackEntry();
 
@@ -285,6 +287,7 @@ namespace spine {
 		float _delay, _trackTime, _trackLast, _nextTrackLast, _trackEnd, _timeScale;
 		float _alpha, _mixTime, _mixDuration, _interruptAlpha, _totalAlpha;
 		MixBlend _mixBlend;
+		size_t _serial;
 		Vector<int> _timelineMode;
 		Vector<TrackEntry *> _timelineHoldMix;
 		Vector<float> _timelinesRotation;
@@ -342,6 +345,8 @@ namespace spine {
 
 		friend class EventQueue;
 
+		friend class SkeletonPose;
+
 	public:
 		explicit AnimationState(AnimationStateData *data);
 
@@ -434,6 +439,10 @@ namespace spine {
 
 		void disposeTrackEntry(TrackEntry *entry);
 
+		/// Creates track entries until at least the specified number are pooled, so setting and queuing that many
+		/// animations doesn't allocate.
+		void preallocateTrackEntries(size_t count);
+
 	private:
 		static const int Subsequent = 0;
 		static const int First = 1;
@@ -458,6 +467,11 @@ namespace spine {
 		AnimationStateListenerObject *_listenerObject;
 
 		int _unkeyedState;
+		size_t _trackEntrySerial;
+
+		// Per timeline alpha and blend while applying a track entry, indexed like Animation::getTimelines().
+		Vector<float> _timelineAlphas;
+		Vector<MixBlend> _timelineBlends;
 
 		float _timeScale;
 
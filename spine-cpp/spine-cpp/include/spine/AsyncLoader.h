@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_AsyncLoader_h
+#define Spine_AsyncLoader_h
+
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+#ifndef SPINE_NO_THREADS
+
+namespace spine {
+	class Atlas;
+
+	class SkeletonData;
+
+	class TextureLoader;
+
+	/// Called on the thread calling AsyncLoader::update() when a load finished. On success the atlas and skeleton data
+	/// are owned by the callback, otherwise both are NULL and the error is set.
+	typedef void (*AsyncLoadCallback)(int id, Atlas *atlas, SkeletonData *skeletonData, const String &error,
+									  void *userData);
+
+	/// Loads atlases and skeleton data on worker threads. Parsing and file IO happen on the workers, while textures are
+	/// created by update() on the owning thread, as texture loaders usually need to run on the render thread.
+	///
+	/// The SpineExtension must be thread safe while loads are in progress, which the DefaultSpineExtension is, and
+	/// String interning must be disabled.
+	///
+	/// Not available when SPINE_NO_THREADS is defined, for targets without std::thread.
+	class SP_API AsyncLoader : public SpineObject {
+	public:
+		/// @param textureLoader Creates the textures of loaded atlases in update(), may be NULL.
+		/// @param numThreads The number of worker threads.
+		explicit AsyncLoader(TextureLoader *textureLoader, int numThreads = 1);
+
+		/// Cancels all loads and waits for the worker threads to finish.
+		~AsyncLoader();
+
+		/// Queues loading an atlas and skeleton data, either binary if the skeleton path ends with ".skel" or JSON.
+		/// @return The id of the load, passed to the callback and to cancel().
+		int load(const String &atlasPath, const String &skeletonPath, AsyncLoadCallback callback, void *userData,
+				 float scale = 1);
+
+		/// Cancels a load. Its callback is not called and its atlas and skeleton data are disposed.
+		/// @return False if the load already completed or the id is unknown.
+		bool cancel(int id);
+
+		/// Creates the textures of finished loads and calls their callbacks. Must be called regularly on the thread owning
+		/// the texture loader.
+		/// @return The number of callbacks called.
+		int update();
+
+		/// Returns the number of loads that were queued and whose callbacks have not been called or which were not
+		/// cancelled yet.
+		int getPendingCount();
+
+	private:
+		struct Load;
+		struct Shared;
+
+		TextureLoader *_textureLoader;
+		Shared *_shared;
+		int _nextId;
+
+		static void work(Shared *shared);
+
+		static void dispose(Load *load);
+	};
+}
+
+#endif
+
+#endif /* Spine_AsyncLoader_h */
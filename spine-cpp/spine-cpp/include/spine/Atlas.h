@@ -118,11 +118,20 @@ namespace spine {
 
 		void flipV();
 
-		/// Returns the first region found with the specified name. This method uses String comparison to find the region, so the result
-		/// should be cached rather than calling this method multiple times.
+		/// Creates the textures of pages that have none, for an atlas loaded with createTexture false, e.g. on the render
+		/// thread after the atlas was loaded on another thread. Regions of these pages that have no renderer object get the
+		/// page texture. The texture loader unloads the textures when the atlas is disposed.
+		void createTextures(TextureLoader *textureLoader);
+
+		/// Returns the first region found with the specified name. Regions are looked up through a hash index over their names,
+		/// which is built when the atlas is loaded. Lookups only read the index, so they are safe from several threads.
 		/// @return The region, or NULL.
 		AtlasRegion *findRegion(const String &name);
 
+		/// Rebuilds the index used by findRegion(). Should be called after regions are added to, removed from or renamed in
+		/// getRegions(). Until then findRegion() stays correct for added and removed regions by falling back to a linear scan.
+		void indexRegions();
+
 		Vector<AtlasPage *> &getPages();
 
 		Vector<AtlasRegion *> &getRegions();
@@ -130,6 +139,8 @@ namespace spine {
 	private:
 		Vector<AtlasPage *> _pages;
 		Vector<AtlasRegion *> _regions;
+		Vector<int> _regionIndex;
+		size_t _indexedRegions;
 		TextureLoader *_textureLoader;
 
 		void load(const char *begin, int length, const char *dir, bool createTexture);
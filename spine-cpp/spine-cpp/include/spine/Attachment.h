@@ -49,9 +49,11 @@ namespace spine {
 
 		int getRefCount();
 
+		/// Attachments shared by several skins are referenced and dereferenced by each, possibly on different threads.
 		void reference();
 
-		void dereference();
+		/// @return The number of references left.
+		int dereference();
 
 	private:
 		const String _name;
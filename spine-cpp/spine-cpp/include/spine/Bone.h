@@ -59,6 +59,8 @@ namespace spine {
 
 		friend class Skeleton;
 
+		friend class SkeletonPose;
+
 		friend class RegionAttachment;
 
 		friend class PointAttachment;
@@ -103,7 +105,8 @@ namespace spine {
 		/// @param parent May be NULL.
 		Bone(BoneData &data, Skeleton &skeleton, Bone *parent = NULL);
 
-		/// Same as updateWorldTransform. This method exists for Bone to implement Spine::Updatable.
+		/// Same as updateWorldTransform. This method exists for Bone to implement Spine::Updatable. When the skeleton is
+		/// tracking changes, the world transform is only recomputed if this bone or its parent changed.
 		virtual void update();
 
 		/// Computes the world transform using the parent bone and this bone's local transform.
@@ -266,6 +269,7 @@ namespace spine {
 		float _c, _d, _worldY;
 		bool _sorted;
 		bool _active;
+		bool _dirty, _changed, _constrained;
 	};
 }
 
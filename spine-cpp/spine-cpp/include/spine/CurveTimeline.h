@@ -53,6 +53,17 @@ namespace spine {
 
 		float getBezierValue(float time, size_t frame, size_t valueOffset, size_t i);
 
+		/// Stores the bezier curves as 16-bit values to reduce memory, see SkeletonBinary::setQuantizeCurves(). Curve
+		/// times are stored relative to the frames they interpolate between, with room for handles that overshoot them by
+		/// the frame duration, and curve values relative to a per curve offset and scale. The curves must not be changed
+		/// afterward.
+		void quantizeCurves();
+
+		/// True if quantizeCurves() was called and the curves have bezier samples.
+		bool isQuantized() { return _quantizedCurves.size() > 0; }
+
+		/// The curve type for each frame followed by the bezier samples, unless the curves are quantized, in which case
+		/// only the curve types remain.
 		Vector<float> &getCurves();
 
 	protected:
@@ -61,7 +72,13 @@ namespace spine {
 		static const int BEZIER = 2;
 		static const int BEZIER_SIZE = 18;
 
+		/// Decodes the quantized bezier samples before and after time into points (x1, y1, x2, y2) and returns the index of
+		/// the sample after time: 0 if time is before the first sample, BEZIER_SIZE if it is after the last.
+		int getQuantizedSamples(float time, size_t i, size_t frameIndex, float *points);
+
 		Vector<float> _curves; // type, x, y, ...
+		Vector<unsigned short> _quantizedCurves; // x, y, ...
+		Vector<float> _curveRanges; // y offset, y scale, ...
 	};
 
 	class SP_API CurveTimeline1 : public CurveTimeline {
@@ -49,10 +49,22 @@ namespace spine {
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
 			  MixDirection direction);
 
-		/// Sets the time and value of the specified keyframe.
+		/// Sets the time and vertices of the specified keyframe. Only the range of vertices that differs from the setup
+		/// pose is stored.
 		void setFrame(int frameIndex, float time, Vector<float> &vertices);
 
-		Vector <Vector<float>> &getVertices();
+		/// Sets the time of the specified keyframe and the vertices from start to start + count. The remaining vertices
+		/// are the setup pose: the attachment's vertices when unweighted or 0 offsets when weighted.
+		void setFrame(int frameIndex, float time, size_t start, const float *vertices, size_t count);
+
+		/// The keyed vertices of every keyframe, getCount() values per frame, starting at vertex getStart().
+		Vector<float> &getVertices();
+
+		/// The index of the first vertex that is keyed by any frame.
+		size_t getStart() { return _start; }
+
+		/// The number of vertices stored per frame. Vertices outside start to start + count are the setup pose.
+		size_t getCount() { return _count; }
 
 		VertexAttachment *getAttachment();
 
@@ -68,10 +80,16 @@ namespace spine {
 
 		void setSlotIndex(int inValue) { _slotIndex = inValue; }
 
+	private:
+		void ensureRange(size_t start, size_t end);
+
+		float getSetupVertex(size_t index);
+
 	protected:
 		int _slotIndex;
 
-		Vector <Vector<float>> _vertices;
+		Vector<float> _vertices;
+		size_t _start, _count;
 
 		VertexAttachment *_attachment;
 	};
@@ -72,8 +72,19 @@ namespace spine {
 
 		static void setInstance(SpineExtension *inSpineExtension);
 
+		/// Returns the extension set for the calling thread, or the global instance if none is set.
 		static SpineExtension *getInstance();
 
+		/// Sets the extension used by the calling thread instead of the global instance, or NULL to use the global
+		/// instance again. This allows each thread to use its own allocator without locking. Memory must be freed with the
+		/// extension that allocated it, so objects created while a thread extension is set must be disposed on that thread
+		/// with the same extension set. See SpineExtensionScope. When SPINE_NO_THREADS is defined this is a plain global
+		/// that takes precedence over the global instance.
+		static void setThreadInstance(SpineExtension *extension);
+
+		/// Returns the extension set for the calling thread, or NULL.
+		static SpineExtension *getThreadInstance();
+
 		virtual ~SpineExtension();
 
 		/// Implement this function to use your own memory allocator
@@ -97,6 +108,21 @@ namespace spine {
 		static SpineExtension *_instance;
 	};
 
+	/// Sets the extension of the calling thread for the lifetime of the scope, then restores the previous one.
+	class SP_API SpineExtensionScope {
+	public:
+		explicit SpineExtensionScope(SpineExtension *extension) : _previous(SpineExtension::getThreadInstance()) {
+			SpineExtension::setThreadInstance(extension);
+		}
+
+		~SpineExtensionScope() {
+			SpineExtension::setThreadInstance(_previous);
+		}
+
+	private:
+		SpineExtension *_previous;
+	};
+
 	class SP_API DefaultSpineExtension : public SpineExtension {
 	public:
 		DefaultSpineExtension();
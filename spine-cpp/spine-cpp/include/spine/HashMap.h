@@ -143,6 +143,12 @@ namespace spine {
 			return find(key) != NULL;
 		}
 
+		/// Returns the value for the key, or NULL.
+		V *get(const K &key) {
+			Entry *entry = find(key);
+			return entry ? &entry->_value : NULL;
+		}
+
 		bool remove(const K &key) {
 			Entry *entry = find(key);
 			if (!entry) return false;
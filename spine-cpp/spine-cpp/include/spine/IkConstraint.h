@@ -46,6 +46,8 @@ namespace spine {
 
 		friend class IkConstraintTimeline;
 
+		friend class SkeletonPose;
+
 	RTTI_DECL
 
 	public:
@@ -70,10 +70,15 @@ namespace spine {
 		/* Supply a block of JSON, and this returns a Json object you can interrogate. Call Json_dispose when finished. */
 		explicit Json(const char *value);
 
+		/* Same as above, for a block of JSON that is not necessarily null terminated. */
+		Json(const char *value, size_t length);
+
 		~Json();
 
 
 	private:
+		struct Arena;
+
 		static const char *_error;
 
 		Json *_next;
@@ -91,23 +96,32 @@ namespace spine {
 
 		const char *_name; /* The item's name string, if this item is the child of, or is in the list of subitems of an object. */
 
+		Json **_children; /* The _size children of an array or object, for indexed access. */
+
+		void *_arena; /* Only set on the root item: a single block holding all other items, the child indices and the unescaped strings. */
+
+		void parse(const char *value, size_t length);
+
 		/* Utility to jump whitespace and cr/lf */
-		static const char *skip(const char *inValue);
+		static char *skip(char *inValue);
 
 		/* Parser core - when encountering text, process appropriately. */
-		static const char *parseValue(Json *item, const char *value);
+		static char *parseValue(Arena &arena, Json *item, char *value);
 
-		/* Parse the input text into an unescaped cstring, and populate item. */
-		static const char *parseString(Json *item, const char *str);
+		/* Parse the input text into an unescaped cstring in place, and populate item. */
+		static char *parseString(Json *item, char *str);
 
 		/* Parse the input text to generate a number, and populate the result into item. */
-		static const char *parseNumber(Json *item, const char *num);
+		static char *parseNumber(Json *item, char *num);
 
 		/* Build an array from input text. */
-		static const char *parseArray(Json *item, const char *value);
+		static char *parseArray(Arena &arena, Json *item, char *value);
 
 		/* Build an object from the text. */
-		static const char *parseObject(Json *item, const char *value);
+		static char *parseObject(Arena &arena, Json *item, char *value);
+
+		/* Links the children of an array or object into an index once its size is known. */
+		static void indexChildren(Arena &arena, Json *item);
 
 		static int json_strcasecmp(const char *s1, const char *s2);
 	};
@@ -54,6 +54,8 @@ namespace spine {
 
 		friend class PathConstraintSpacingTimeline;
 
+		friend class SkeletonPose;
+
 	RTTI_DECL
 
 	public:
@@ -36,38 +36,80 @@
 #include <spine/SpineObject.h>
 
 namespace spine {
+	/// Recycles objects of type T. Free objects are kept in a list linked through memory allocated after each object, so
+	/// obtain() and free() don't search or allocate. Objects freed to a pool must have been obtained from it. Obtained
+	/// objects may also be deleted instead of freed.
 	template<typename T>
 	class SP_API Pool : public SpineObject {
 	public:
-		Pool() {
+		Pool() : _free(NULL), _freeCount(0) {
 		}
 
 		~Pool() {
-			ContainerUtil::cleanUpVectorOfPointers(_objects);
+			while (_free) {
+				T *object = _free;
+				_free = getLink(object)->next;
+				delete object;
+			}
 		}
 
 		T *obtain() {
-			if (_objects.size() > 0) {
-				T **object = &_objects[_objects.size() - 1];
-				T *ret = *object;
-				_objects.removeAt(_objects.size() - 1);
-
-				return ret;
-			} else {
-				T *ret = new(__FILE__, __LINE__) T();
-
-				return ret;
+			if (_free) {
+				T *object = _free;
+				Link *link = getLink(object);
+				_free = link->next;
+				link->next = NULL;
+				link->isFree = false;
+				_freeCount--;
+				return object;
 			}
+			return create();
 		}
 
 		void free(T *object) {
-			if (!_objects.contains(object)) {
-				_objects.add(object);
-			}
+			Link *link = getLink(object);
+			// Freeing an object twice is a bug, in release builds the second free is ignored.
+			assert(!link->isFree);
+			if (link->isFree) return;
+			link->next = _free;
+			link->isFree = true;
+			_free = object;
+			_freeCount++;
+		}
+
+		/// Creates objects until the pool has at least the specified number of free objects, so that many obtain() calls
+		/// don't allocate.
+		void preallocate(size_t count) {
+			while (_freeCount < count)
+				free(create());
+		}
+
+		/// Returns the number of free objects.
+		size_t getFreeCount() {
+			return _freeCount;
 		}
 
 	private:
-		Vector<T *> _objects;
+		struct Link {
+			T *next;
+			bool isFree;
+		};
+
+		// The link follows the object, aligned for a pointer.
+		static const size_t LinkOffset = (sizeof(T) + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+
+		T *_free;
+		size_t _freeCount;
+
+		static Link *getLink(T *object) {
+			return (Link *) ((char *) object + LinkOffset);
+		}
+
+		// The object is at the start of the memory, so deleting it frees the link too.
+		T *create() {
+			void *memory = SpineExtension::calloc<char>(LinkOffset + sizeof(Link), __FILE__, __LINE__);
+			return new(memory) T();
+		}
 	};
 }
 
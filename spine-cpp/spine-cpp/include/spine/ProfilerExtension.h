@@ -0,0 +1,172 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_ProfilerExtension_h
+#define Spine_ProfilerExtension_h
+
+#include <spine/Extension.h>
+
+#include <stdio.h>
+
+namespace spine {
+	/// An extension that forwards to another extension and profiles the allocations made through it. Statistics are kept
+	/// per call site (file and line): allocation, reallocation and free counts, bytes requested, live bytes, peak live
+	/// bytes and the number of frames the site allocated in. A histogram of allocations per frame is kept for frames
+	/// ended with endFrame().
+	///
+	/// Allocations are tracked in hash tables allocated with malloc, so profiling costs a few hash lookups per call and
+	/// can be used in optimized builds. The profiler is not thread safe; use one per thread with
+	/// SpineExtension::setThreadInstance() to profile several threads.
+	class SP_API ProfilerExtension : public SpineExtension {
+	public:
+		/// Frames are counted in buckets by their number of allocations: bucket 0 counts frames without allocations,
+		/// bucket i counts frames with 2^(i-1) to 2^i - 1 allocations. The last bucket also counts all larger frames.
+		static const int FrameBuckets = 17;
+
+		struct Site {
+			const char *file;
+			int line;
+			size_t allocations;
+			size_t reallocations;
+			/// Frees of memory allocated or last reallocated at this site.
+			size_t frees;
+			/// Bytes requested by allocations and reallocations.
+			size_t bytes;
+			size_t liveBytes;
+			size_t peakLiveBytes;
+			/// The number of frames with allocations or reallocations from this site.
+			size_t frames;
+			size_t lastFrame;
+		};
+
+		explicit ProfilerExtension(SpineExtension *extension);
+
+		virtual ~ProfilerExtension();
+
+		/// Ends the current frame, adding its allocation count to the frame histogram.
+		void endFrame();
+
+		/// Clears the counters, so only allocations made from now on are reported. Live allocations are still tracked,
+		/// peak live bytes restart from the current live bytes.
+		void reset();
+
+		/// Writes all statistics as JSON, with sites sorted by bytes requested.
+		void dump(FILE *file);
+
+		size_t getSiteCount() { return _siteCount; }
+
+		/// Sites are listed in the order they first allocated. A site used from several translation units (e.g. a
+		/// template in a header) is reported once.
+		const Site &getSite(size_t index) { return _sites[index]; }
+
+		size_t getAllocations() { return _allocations; }
+
+		size_t getReallocations() { return _reallocations; }
+
+		size_t getFrees() { return _frees; }
+
+		/// The number of frees of memory not allocated through this extension, or freed twice.
+		size_t getUntrackedFrees() { return _untrackedFrees; }
+
+		size_t getLiveBytes() { return _liveBytes; }
+
+		size_t getPeakLiveBytes() { return _peakLiveBytes; }
+
+		/// The number of live allocations.
+		size_t getLiveCount() { return _liveCount; }
+
+		size_t getFrameCount() { return _frame; }
+
+		/// See FrameBuckets.
+		size_t getFrameHistogram(int bucket) { return _frameHistogram[bucket]; }
+
+		/// Returns true if the memory was allocated through this extension and not freed yet.
+		bool isLive(void *mem);
+
+		/// Calls the callback with each live allocation.
+		void forEachLive(void (*callback)(void *address, size_t size, const Site &site, void *userData), void *userData);
+
+		virtual void *_alloc(size_t size, const char *file, int line) override;
+
+		virtual void *_calloc(size_t size, const char *file, int line) override;
+
+		virtual void *_realloc(void *ptr, size_t size, const char *file, int line) override;
+
+		virtual void _free(void *mem, const char *file, int line) override;
+
+		virtual char *_readFile(const String &path, int *length) override;
+
+		virtual void _beforeFree(void *ptr) override;
+
+	protected:
+		/// Forgets all live allocations and clears the counters.
+		void clear();
+
+	private:
+		struct SiteKey {
+			const char *file;
+			int line;
+			int site;
+		};
+
+		struct Live {
+			void *address;
+			size_t size;
+			int site;
+		};
+
+		SpineExtension *_extension;
+		Site *_sites;
+		size_t _siteCount, _siteCapacity;
+		SiteKey *_siteKeys;
+		size_t _siteKeyCount, _siteKeyCapacity;
+		Live *_live;
+		size_t _liveCount, _liveCapacity;
+		size_t _allocations, _reallocations, _frees, _untrackedFrees;
+		size_t _liveBytes, _peakLiveBytes;
+		size_t _frame, _frameAllocations;
+		size_t _frameHistogram[FrameBuckets];
+
+		int findSite(const char *file, int line);
+
+		void record(int site, size_t size, bool reallocation);
+
+		void track(void *address, size_t size, int site);
+
+		/// Stops tracking the memory, returning the site that allocated it or -1.
+		int untrack(void *address);
+
+		void growSiteKeys();
+
+		void growLive();
+	};
+}
+
+#endif /* Spine_ProfilerExtension_h */
@@ -51,6 +51,8 @@ namespace spine {
 
 		friend class AtlasAttachmentLoader;
 
+		friend class SkinningData;
+
 	RTTI_DECL
 
 	public:
@@ -36,6 +36,10 @@
 #include <spine/SpineString.h>
 #include <spine/Color.h>
 
+#ifndef SPINE_NO_THREADS
+#include <spine/UpdatePool.h>
+#endif
+
 namespace spine {
 	class SkeletonData;
 
@@ -55,13 +59,27 @@ namespace spine {
 
 	class Attachment;
 
+	class ConstraintData;
+
+	class AnimationState;
+
+	class AnimationBounds;
+
 	class SP_API Skeleton : public SpineObject {
 		friend class AnimationState;
 
+		friend class Bone;
+
+		friend class IkConstraint;
+
 		friend class SkeletonBounds;
 
 		friend class SkeletonClipping;
 
+		friend class SkeletonPose;
+
+		friend class SkeletonRenderer;
+
 		friend class AttachmentTimeline;
 
 		friend class RGBATimeline;
@@ -118,7 +136,7 @@ namespace spine {
 		~Skeleton();
 
 		/// Caches information about bones and constraints. Must be called if bones, constraints or weighted path attachments are added
-		/// or removed.
+		/// or removed. This also discards the update caches memoized by setSkin().
 		void updateCache();
 
 		void printUpdateCache();
@@ -128,6 +146,36 @@ namespace spine {
 
 		void updateWorldTransform(Bone *parent);
 
+		/// When true, updateWorldTransform() skips bones whose local transform, and whose parent's world transform, have not
+		/// changed since the previous update. Bones constrained by IK, transform or path constraints are always updated, as
+		/// are their descendants. Changes not made through a bone's local transform or Bone setters, such as changes to
+		/// BoneData, require calling updateCache(). Default is false.
+		bool isChangeTracking();
+
+		void setChangeTracking(bool inValue);
+
+#ifndef SPINE_NO_THREADS
+		/// When set, updateWorldTransform() updates bones and constraints that don't depend on each other concurrently on the
+		/// pool's threads, giving the same world transforms as updating them in order. Bones only depend on their parent,
+		/// so this pays off for skeletons with many bones, most of all wide hierarchies. Path constraints wait for everything
+		/// before them and everything after them waits for them. Default is NULL. Not available when SPINE_NO_THREADS is
+		/// defined.
+		void setUpdatePool(UpdatePool *pool);
+
+		UpdatePool *getUpdatePool();
+#endif
+
+		/// Returns a number that changes when anything affecting how the skeleton is rendered changed since a previous call, so
+		/// a renderer can reuse its output from a previous frame while the number stays the same. Generations of different
+		/// skeletons are unrelated and are not comparable. Setting a slot's attachment
+		/// or sequence index (including by attachment and sequence timelines), the skin or restoring a SkeletonPose increments
+		/// it. The bones' world transforms, the skeleton and slot colors, the slots' deform and the draw order are written in
+		/// place every frame, so they are instead compared with their values at the previous call.
+		size_t getGeneration();
+
+		/// Increments the generation, for changes that it does not detect, such as to an attachment's color or region.
+		void markChanged();
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
@@ -147,6 +195,9 @@ namespace spine {
 
 		/// Attachments from the new skin are attached if the corresponding attachment from the old skin was attached.
 		/// If there was no old skin, each slot's setup mode attachment is attached from the new skin.
+		/// The update cache computed for the new skin is memoized by the skin's bones and constraints, so switching back and
+		/// forth between skins does not need to recompute it. If attachments of a skin used by a path constraint are changed,
+		/// call updateCache() to discard the memoized caches.
 		/// After changing the skin, the visible attachments can be reset to those attached in the setup pose by calling
 		/// See Skeleton::setSlotsToSetupPose()
 		/// Also, often AnimationState::apply(Skeleton&) is called before the next time the
@@ -180,6 +231,19 @@ namespace spine {
 		/// @param outVertexBuffer Reference to hold a Vector of floats. This method will assign it with new floats as needed.
 		void getBounds(float &outX, float &outY, float &outWidth, float &outHeight, Vector<float> &outVertexBuffer);
 
+		/// Estimates the axis-aligned bounding box of the skeleton from the precomputed bounds of the animations on the
+		/// animation state's tracks, including animations being mixed out, and the skeleton's position and scale. The cost
+		/// depends only on the number of track entries. The bounds are approximate: they can be smaller than getBounds()
+		/// during mixes and with several tracks, see AnimationBounds. Use them where being slightly off is acceptable, eg
+		/// for layout or to sort and prioritize skeletons, but not to skip applying the animation state, updating the world
+		/// transform or rendering a skeleton that may be visible. The setup pose bounds are included when the first track is
+		/// empty or an entry is mixing, has an alpha less than 1 or has no timelines. Bones and slots not keyed by the
+		/// animations are expected to be in the setup pose, eg by calling setToSetupPose() when changing animations.
+		/// @param bounds Bounds computed for this skeleton's data and skin.
+		/// @return False if an entry's animation was not sampled by the bounds, in which case the output is not set.
+		bool getEstimatedBounds(AnimationState &state, AnimationBounds &bounds, float &outX, float &outY, float &outWidth,
+								float &outHeight);
+
 		Bone *getRootBone();
 
 		SkeletonData *getData();
@@ -220,7 +284,17 @@ namespace spine {
 
 		void setScaleY(float inValue);
 
+		/// Scales all lengths in the skeleton data, the same as SkeletonJson::setScale() and SkeletonBinary::setScale() do
+		/// when loading, so one SkeletonData can be shared by skeletons shown at different sizes. Like the scale X and Y, it
+		/// is applied to the root bone's world transform, and it also scales the positions and spacing that path
+		/// constraints measure along a path. Default is 1.
+		float getDataScale();
+
+		void setDataScale(float inValue);
+
 	private:
+		struct SkinUpdateCache;
+
 		SkeletonData *_data;
 		Vector<Bone *> _bones;
 		Vector<Slot *> _slots;
@@ -229,10 +303,49 @@ namespace spine {
 		Vector<TransformConstraint *> _transformConstraints;
 		Vector<PathConstraint *> _pathConstraints;
 		Vector<Updatable *> _updateCache;
+		Vector<SkinUpdateCache *> _skinUpdateCaches;
+		Vector<int> _skinBones;
+		Vector<ConstraintData *> _skinConstraints;
+		Vector<int> _pathBones;
+		Vector<Updatable *> _constraintsByOrder;
 		Skin *_skin;
 		Color _color;
 		float _scaleX, _scaleY;
+		float _dataScale;
 		float _x, _y;
+		bool _changeTracking, _trackingChanges, _updateAll;
+		float _updatedX, _updatedY, _updatedScaleX, _updatedScaleY;
+		size_t _id;
+		size_t _generation;
+		Vector<float> _generationPose;
+		Vector<Slot *> _generationDrawOrder;
+#ifndef SPINE_NO_THREADS
+		UpdatePool *_updatePool;
+#endif
+		bool _updateStagesDirty;
+#ifndef SPINE_NO_THREADS
+		Vector<Updatable *> _updateStageOrder;
+		Vector<UpdatePool::Stage> _updateStages;
+#endif
+
+		/// The scale X and Y applied to the root bone's world transform, including the data scale.
+		float getRootScaleX();
+
+		float getRootScaleY();
+
+		void updateSkinCache();
+
+		void updateConstrainedBones();
+
+		void computeUpdateCache();
+
+#ifndef SPINE_NO_THREADS
+		void computeUpdateStages();
+#endif
+
+		void updateCacheItems();
+
+		bool isSkinConstraint(ConstraintData *data);
 
 		void sortIkConstraint(IkConstraint *constraint);
 
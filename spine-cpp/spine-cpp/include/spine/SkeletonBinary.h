@@ -106,6 +106,11 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// If true, timeline bezier curves are stored as 16-bit values, using about 40% less memory for curves at the
+		/// cost of slightly slower and less precise curve evaluation. See CurveTimeline::quantizeCurves(). Default is
+		/// false.
+		void setQuantizeCurves(bool quantizeCurves) { _quantizeCurves = quantizeCurves; }
+
 		String &getError() { return _error; }
 
 	private:
@@ -118,6 +123,7 @@ namespace spine {
 		Vector<LinkedMesh *> _linkedMeshes;
 		String _error;
 		float _scale;
+		bool _quantizeCurves;
 		const bool _ownsLoader;
 
 		void setError(const char *value1, const char *value2);
@@ -42,7 +42,10 @@ namespace spine {
 	class Polygon;
 
 	/// Collects each BoundingBoxAttachment that is visible and computes the world vertices for its polygon.
-	/// The polygon vertices are provided along with convenience methods for doing hit detection.
+	/// The polygon vertices are provided along with convenience methods for doing hit detection. Each polygon also stores its
+	/// axis aligned bounding box, which the hit detection methods check before testing the polygon's edges.
+	///
+	/// See SkeletonBoundsGrid for hit detection across many skeletons.
 	class SP_API SkeletonBounds : public SpineObject {
 	public:
 		SkeletonBounds();
@@ -50,7 +53,8 @@ namespace spine {
 		~SkeletonBounds();
 
 		/// Clears any previous polygons, finds all visible bounding box attachments,
-		/// and computes the world vertices for each bounding box's polygon.
+		/// and computes the world vertices and axis aligned bounding box for each bounding box's polygon. Polygons from the
+		/// previous update are reused.
 		/// @param skeleton The skeleton.
 		/// @param updateAabb
 		/// If true, the axis aligned bounding box containing all the polygons is computed.
@@ -94,6 +98,14 @@ namespace spine {
         /// Returns all bounding boxes. Requires a call to update() first.
         Vector<BoundingBoxAttachment *> &getBoundingBoxes();
 
+		float getMinX();
+
+		float getMinY();
+
+		float getMaxX();
+
+		float getMaxY();
+
 		float getWidth();
 
 		float getHeight();
@@ -111,8 +123,9 @@ namespace spine {
 	public:
 		Vector<float> _vertices;
 		int _count;
+		float _minX, _minY, _maxX, _maxY;
 
-		Polygon() : _count(0) {
+		Polygon() : _count(0), _minX(0), _minY(0), _maxX(0), _maxY(0) {
 			_vertices.ensureCapacity(16);
 		}
 	};
@@ -0,0 +1,109 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonBoundsGrid_h
+#define Spine_SkeletonBoundsGrid_h
+
+#include <spine/Vector.h>
+
+namespace spine {
+	class SkeletonBounds;
+
+	/// A broad phase for hit detection across many skeletons. Each SkeletonBounds is stored in the cells of a uniform grid
+	/// that its axis aligned bounding box overlaps, so a query only tests the bounds in the cells it touches. Cells are hashed
+	/// into buckets, so the grid has no fixed extent.
+	///
+	/// Each frame, update the SkeletonBounds with updateAabb set to true, then call update(), which only moves bounds whose
+	/// AABB now overlaps different cells.
+	class SP_API SkeletonBoundsGrid : public SpineObject {
+	public:
+		/// @param cellSize The width and height of a cell in world units. Around the size of a typical skeleton works well.
+		explicit SkeletonBoundsGrid(float cellSize);
+
+		~SkeletonBoundsGrid();
+
+		/// Adds the bounds to the grid. The bounds are not owned by the grid and must be removed before they are disposed.
+		void add(SkeletonBounds *bounds);
+
+		void remove(SkeletonBounds *bounds);
+
+		void clear();
+
+		/// Moves each bounds whose AABB changed since it was last stored to the cells it now overlaps.
+		void update();
+
+		/// Finds the bounds that have a bounding box attachment containing the point.
+		/// @param outHits Cleared, then set to the bounds that were hit.
+		void containsPoint(float x, float y, Vector<SkeletonBounds *> &outHits);
+
+		/// Finds the bounds that have a bounding box attachment intersecting the line segment.
+		/// @param outHits Cleared, then set to the bounds that were hit.
+		void intersectsSegment(float x1, float y1, float x2, float y2, Vector<SkeletonBounds *> &outHits);
+
+		/// Finds the bounds that have a bounding box attachment whose AABB overlaps the box.
+		/// @param outHits Cleared, then set to the bounds that were hit.
+		void intersectsBox(float minX, float minY, float maxX, float maxY, Vector<SkeletonBounds *> &outHits);
+
+		/// The bounds in the grid.
+		Vector<SkeletonBounds *> &getBounds();
+
+		float getCellSize();
+
+	private:
+		struct Entry;
+
+		float _cellSize;
+		Vector<SkeletonBounds *> _bounds;
+		Vector<Entry *> _entries;
+		Vector<Entry *> _unbounded;
+		Vector<Vector<Entry *> *> _buckets;
+		size_t _cellCount;
+		int _queryId;
+
+		void insert(Entry *entry);
+
+		void erase(Entry *entry);
+
+		void rehash(size_t bucketCount);
+
+		Vector<Entry *> &getBucket(int cellX, int cellY);
+
+		void queryCell(int cellX, int cellY, float x1, float y1, float x2, float y2, int type,
+					   Vector<SkeletonBounds *> &outHits);
+
+		void test(Entry *entry, float x1, float y1, float x2, float y2, int type, Vector<SkeletonBounds *> &outHits);
+
+		void testAll(float x1, float y1, float x2, float y2, int type, Vector<SkeletonBounds *> &outHits);
+
+		float visitLimit();
+	};
+}
+
+#endif /* Spine_SkeletonBoundsGrid_h */
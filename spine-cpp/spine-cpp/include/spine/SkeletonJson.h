@@ -75,15 +75,23 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// If true, timeline bezier curves are stored as 16-bit values, using about 40% less memory for curves at the
+		/// cost of slightly slower and less precise curve evaluation. See CurveTimeline::quantizeCurves(). Default is
+		/// false.
+		void setQuantizeCurves(bool quantizeCurves) { _quantizeCurves = quantizeCurves; }
+
 		String &getError() { return _error; }
 
 	private:
 		AttachmentLoader *_attachmentLoader;
 		Vector<LinkedMesh *> _linkedMeshes;
 		float _scale;
+		bool _quantizeCurves;
 		const bool _ownsLoader;
 		String _error;
 
+		SkeletonData *readSkeletonDataRoot(Json *root);
+
 		static Sequence *readSequence(Json *sequence);
 
 		static void
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonPose_h
+#define Spine_SkeletonPose_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	class Skeleton;
+
+	class AnimationState;
+
+	class TrackEntry;
+
+	/// Stores a snapshot of a skeleton's pose, and optionally of an animation state's track times, in a single contiguous
+	/// buffer. Restoring the snapshot puts the skeleton and animation state back exactly as they were when it was captured,
+	/// so that applying the same updates again reproduces the same poses. This can be used for rollback and replay.
+	///
+	/// The snapshot references the skeleton's attachments and the animation state's track entries, so it must only be
+	/// restored to the skeleton and animation state it was captured from.
+	class SP_API SkeletonPose : public SpineObject {
+	public:
+		SkeletonPose();
+
+		~SkeletonPose();
+
+		/// Captures the skin, color and position of the skeleton, the local, applied and world transforms of the bones, the
+		/// colors, attachment, deform and sequence index of the slots, the constraint mixes and the draw order.
+		void capture(Skeleton &skeleton);
+
+		/// Captures the skeleton as above, plus the times, mix times and rotation directions of the track entries on the
+		/// animation state's tracks, including entries being mixed from and queued entries.
+		void capture(Skeleton &skeleton, AnimationState &state);
+
+		/// Restores the skeleton to the captured pose. The world transforms are restored too, so
+		/// Skeleton::updateWorldTransform() does not need to be called.
+		void restore(Skeleton &skeleton);
+
+		/// Restores the skeleton and the animation state's track times.
+		///
+		/// Only track times are restored, not the track structure: entries that were added or removed since the capture
+		/// cannot be brought back. This happens after setAnimation(), addAnimation() or clearTrack(), and also during
+		/// AnimationState::update() when a mix finishes or a queued entry starts. Rollback windows that span such a change
+		/// fail, so capture again after it, eg when the listener receives the start or end event.
+		/// @return False if no animation state was captured or the animation state's tracks no longer hold the captured track
+		/// entries. In that case neither the skeleton nor the animation state is changed.
+		bool restore(Skeleton &skeleton, AnimationState &state);
+
+		/// The number of bytes used by the snapshot.
+		size_t getSize();
+
+	private:
+		char *_buffer;
+		size_t _size;
+		size_t _capacity;
+		size_t _stateOffset;
+
+		void captureSkeleton(Skeleton &skeleton, size_t stateSize);
+
+		static size_t trackEntrySize(TrackEntry *entry);
+
+		static void captureTrackEntry(char *&cursor, TrackEntry *entry);
+
+		static void restoreTrackEntry(const char *&cursor, TrackEntry *entry);
+	};
+}
+
+#endif /* Spine_SkeletonPose_h */
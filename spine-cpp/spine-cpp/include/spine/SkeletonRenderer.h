@@ -0,0 +1,129 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonRenderer_h
+#define Spine_SkeletonRenderer_h
+
+#include <spine/BlendMode.h>
+#include <spine/SkeletonClipping.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Skeleton;
+
+	class Slot;
+
+	class Attachment;
+
+	/// Describes the interleaved vertex layout that SkeletonRenderer writes. Offsets are in bytes from the start of a vertex,
+	/// -1 omits an attribute. Positions and UVs are two floats, so the stride and their offsets must be multiples of 4. Colors
+	/// are packed into 32 bits using the channel shifts.
+	class SP_API VertexFormat {
+	public:
+		/// The default channel shifts store colors as the bytes r, g, b, a, as used by SDL_Color and cocos2d::Color4B.
+		VertexFormat(size_t vertexStride, int positionBytes, int uvBytes, int colorBytes = -1, int darkColorBytes = -1);
+
+		/// Sets the bit shifts of the channels in a packed color, eg 16, 8, 0, 24 for a 0xAARRGGBB integer.
+		void setColorShifts(int red, int green, int blue, int alpha);
+
+		size_t stride;
+		int positionOffset;
+		int uvOffset;
+		int colorOffset;
+		int darkColorOffset;
+		int redShift, greenShift, blueShift, alphaShift;
+	};
+
+	/// A range of SkeletonRenderer's vertices and indices drawn with the same texture and blend mode.
+	class SP_API RenderCommand {
+	public:
+		/// The TextureRegion::rendererObject of the attachments, which is the AtlasPage::texture for atlas regions.
+		void *texture;
+		BlendMode blendMode;
+		/// The index of the first vertex. Indices are relative to it.
+		size_t vertexStart;
+		size_t vertexCount;
+		size_t indexStart;
+		size_t indexCount;
+	};
+
+	/// Walks a skeleton's draw order once, computing world vertices, clipping and writing the vertices directly in the
+	/// caller's interleaved VertexFormat. Consecutive attachments with the same texture and blend mode are batched into a
+	/// single RenderCommand, so an engine can upload the vertices and indices as they are and issue one draw call per command.
+	class SP_API SkeletonRenderer : public SpineObject {
+	public:
+		explicit SkeletonRenderer(const VertexFormat &format);
+
+		~SkeletonRenderer();
+
+		/// Replaces the vertices, indices and commands with those of the skeleton's region and mesh attachments. The skeleton's
+		/// world transforms must be up to date. The previous output is kept if the skeleton is the one last rendered and its
+		/// Skeleton::getGeneration() has not changed. Skeletons are told apart by an ID that is unique for each skeleton
+		/// instance, so a skeleton allocated where a disposed one was is rendered anew.
+		/// @return False if the previous output was kept, so it does not need to be uploaded again.
+		bool render(Skeleton &skeleton);
+
+		const VertexFormat &getVertexFormat();
+
+		/// If true, the color is multiplied by its alpha and the dark color's alpha is 1. Default is false.
+		bool getPremultipliedAlpha();
+
+		void setPremultipliedAlpha(bool premultipliedAlpha);
+
+		/// The vertices in the vertex format, getVertexCount() * stride bytes.
+		void *getVertices();
+
+		size_t getVertexCount();
+
+		Vector<unsigned short> &getIndices();
+
+		Vector<RenderCommand> &getCommands();
+
+	private:
+		VertexFormat _format;
+		bool _premultipliedAlpha;
+		size_t _skeletonId;
+		size_t _generation;
+		unsigned char *_vertices;
+		size_t _vertexCount;
+		size_t _vertexCapacity;
+		Vector<unsigned short> _indices;
+		Vector<RenderCommand> _commands;
+		Vector<float> _worldVertices;
+		SkeletonClipping _clipper;
+
+		unsigned char *addVertices(size_t count);
+
+		void addCommand(void *texture, BlendMode blendMode, size_t vertexCount, const unsigned short *indices,
+						size_t indexCount);
+	};
+}
+
+#endif /* Spine_SkeletonRenderer_h */
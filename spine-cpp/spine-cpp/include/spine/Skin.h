@@ -57,11 +57,15 @@ namespace spine {
 				size_t _slotIndex;
 				String _name;
 				Attachment *_attachment;
+				/// True if the attachment was shared from another skin by Skin::shareSkin() and must be copied before it is
+				/// changed.
+				bool _copyOnWrite;
 
-				Entry(size_t slotIndex, const String &name, Attachment *attachment) :
+				Entry(size_t slotIndex, const String &name, Attachment *attachment, bool copyOnWrite = false) :
 						_slotIndex(slotIndex),
 						_name(name),
-						_attachment(attachment) {
+						_attachment(attachment),
+						_copyOnWrite(copyOnWrite) {
 				}
 			};
 
@@ -97,7 +101,7 @@ namespace spine {
 				size_t _bucketIndex;
 			};
 
-			void put(size_t slotIndex, const String &attachmentName, Attachment *attachment);
+			void put(size_t slotIndex, const String &attachmentName, Attachment *attachment, bool copyOnWrite = false);
 
 			Attachment *get(size_t slotIndex, const String &attachmentName);
 
@@ -126,6 +130,11 @@ namespace spine {
 		/// Returns the attachment for the specified slot index and name, or NULL.
 		Attachment *getAttachment(size_t slotIndex, const String &name);
 
+		/// Returns the attachment for the specified slot index and name, or NULL. If the attachment was shared from another
+		/// skin by shareSkin() and is still shared, it is first replaced in this skin by a copy, so it can be changed without
+		/// affecting the other skin. Slots that show the shared attachment keep showing it.
+		Attachment *getWritableAttachment(size_t slotIndex, const String &name);
+
 		// Removes the attachment from the skin.
 		void removeAttachment(size_t slotIndex, const String &name);
 
@@ -147,6 +156,12 @@ namespace spine {
 		/// Adds all attachments, bones, and constraints from the specified skin to this skin. Attachments are deep copied.
 		void copySkin(Skin *other);
 
+		/// Adds all attachments, bones, and constraints from the specified skin to this skin. Attachments are copied on write:
+		/// this skin shares them with the other skin until getWritableAttachment() is called on this skin for an attachment,
+		/// which then gets its own copy. The other skin is not modified, so changes to its attachments, or to shared
+		/// attachments obtained from this skin through getAttachment(), are seen by both skins.
+		void shareSkin(Skin *other);
+
 		AttachmentMap::Entries getAttachments();
 
 		Vector<BoneData *> &getBones();
@@ -0,0 +1,156 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkinningData_h
+#define Spine_SkinningData_h
+
+#include <spine/Vector.h>
+
+namespace spine {
+	class SkeletonData;
+
+	class Skeleton;
+
+	class Skin;
+
+	class Slot;
+
+	class Attachment;
+
+	/// The vertices of a region or mesh attachment for a slot in a SkinningData's vertex buffers.
+	class SP_API SkinningAttachment : public SpineObject {
+		friend class SkinningData;
+
+	public:
+		size_t getSlotIndex();
+
+		Attachment *getAttachment();
+
+		/// The index of the attachment's first vertex in the vertex buffers.
+		size_t getVertexOffset();
+
+		size_t getVertexCount();
+
+		/// The index of the attachment's first triangle index in SkinningData::getTriangles().
+		size_t getTriangleOffset();
+
+		size_t getTriangleCount();
+
+	private:
+		SkinningAttachment(size_t slotIndex, Attachment *attachment, size_t vertexOffset, size_t vertexCount,
+						   size_t triangleOffset, size_t triangleCount);
+
+		size_t _slotIndex;
+		Attachment *_attachment;
+		size_t _vertexOffset, _vertexCount;
+		size_t _triangleOffset, _triangleCount;
+	};
+
+	/// Exports the region and mesh attachments of a skin as static vertex buffers, so an engine can upload them once and skin
+	/// the vertices in a vertex shader instead of calling VertexAttachment::computeWorldVertices() and uploading world
+	/// vertices every frame.
+	///
+	/// Every vertex stores getInfluenceCount() influences, each with a bone index, a weight and the vertex position in that
+	/// bone's local coordinates. Unused influences have a weight of 0. Each frame, computeBonePalette() provides the bones'
+	/// world transforms and computeDeformedPositions() provides the positions of attachments deformed by a slot. The world
+	/// position of a vertex is the sum over its influences of (x * a + y * b + worldX, x * c + y * d + worldY) * weight, which
+	/// computeWorldVertices() evaluates on the CPU with the same results as VertexAttachment::computeWorldVertices() and
+	/// RegionAttachment::computeWorldVertices().
+	///
+	/// The UVs are those of the attachments when the instance is created. Attachments with a sequence change their region per
+	/// frame, so their UVs must be taken from the attachment instead.
+	class SP_API SkinningData : public SpineObject {
+	public:
+		/// @param skin May be NULL to export only the default skin.
+		SkinningData(SkeletonData &skeletonData, Skin *skin = NULL);
+
+		~SkinningData();
+
+		SkeletonData &getSkeletonData();
+
+		Skin *getSkin();
+
+		/// The number of influences stored per vertex, which is the most bones affecting any vertex.
+		size_t getInfluenceCount();
+
+		/// The attachments in the vertex buffers, ordered by slot index.
+		Vector<SkinningAttachment *> &getAttachments();
+
+		/// Returns the attachment's vertices for the slot, or NULL if it is not a region or mesh attachment of the skin.
+		SkinningAttachment *findAttachment(size_t slotIndex, Attachment *attachment);
+
+		/// The index of each vertex influence's bone in the skeleton's bones, getInfluenceCount() per vertex.
+		Vector<unsigned short> &getBoneIndices();
+
+		/// The weight of each vertex influence, getInfluenceCount() per vertex.
+		Vector<float> &getWeights();
+
+		/// The x,y position of each vertex influence in its bone's local coordinates, getInfluenceCount() pairs per vertex.
+		Vector<float> &getPositions();
+
+		/// The u,v pair of each vertex.
+		Vector<float> &getUVs();
+
+		/// The triangles of each attachment, as indices relative to the attachment's first vertex.
+		Vector<unsigned short> &getTriangles();
+
+		/// Stores the world transform of each of the skeleton's bones as a, b, c, d, worldX, worldY.
+		static void computeBonePalette(Skeleton &skeleton, Vector<float> &palette);
+
+		/// Stores the positions of the attachment's vertex influences with the slot's deform applied, in the same layout as
+		/// getPositions(), to be used instead of the static positions.
+		/// @return False if the slot has no deform, in which case the static positions are used and positions is not changed.
+		bool computeDeformedPositions(Slot &slot, SkinningAttachment &attachment, Vector<float> &positions);
+
+		/// Computes the world vertices of the attachment the way a vertex shader would.
+		/// @param palette The bone palette from computeBonePalette().
+		/// @param deformedPositions The positions from computeDeformedPositions(), or NULL to use the static positions.
+		void computeWorldVertices(SkinningAttachment &attachment, const float *palette, const float *deformedPositions,
+								  float *worldVertices, size_t offset, size_t stride);
+
+	private:
+		SkeletonData &_skeletonData;
+		Skin *_skin;
+		size_t _influenceCount;
+		Vector<SkinningAttachment *> _attachments;
+		Vector<size_t> _slotAttachments;
+		Vector<unsigned short> _boneIndices;
+		Vector<float> _weights;
+		Vector<float> _positions;
+		Vector<float> _uvs;
+		Vector<unsigned short> _triangles;
+
+		void addAttachment(size_t slotIndex, Attachment *attachment);
+
+		void addVertices(size_t slotIndex, Attachment *attachment);
+	};
+}
+
+#endif /* Spine_SkinningData_h */
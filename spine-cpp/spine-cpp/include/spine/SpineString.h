@@ -37,129 +37,102 @@
 #include <stdio.h>
 
 namespace spine {
+	/// A null terminated string. Strings up to 15 characters are stored inline without allocating. Longer strings are
+	/// allocated, or shared through a global table when interning is enabled, see setInterning().
 	class SP_API String : public SpineObject {
 	public:
-		String() : _length(0), _buffer(NULL) {
+		String() {
+			setNull();
 		}
 
 		String(const char *chars, bool own = false) {
-			if (!chars) {
-				_length = 0;
-				_buffer = NULL;
-			} else {
-				_length = strlen(chars);
-				if (!own) {
-					_buffer = SpineExtension::calloc<char>(_length + 1, __FILE__, __LINE__);
-					memcpy((void *) _buffer, chars, _length + 1);
-				} else {
-					_buffer = (char *) chars;
-				}
-			}
+			setNull();
+			if (own)
+				this->own(chars);
+			else if (chars)
+				set(chars, strlen(chars));
 		}
 
 		String(const String &other) {
-			if (!other._buffer) {
-				_length = 0;
-				_buffer = NULL;
-			} else {
-				_length = other._length;
-				_buffer = SpineExtension::calloc<char>(other._length + 1, __FILE__, __LINE__);
-				memcpy((void *) _buffer, other._buffer, other._length + 1);
-			}
+			setNull();
+			copy(other);
+		}
+
+		String(String &&other) {
+			setNull();
+			own(other);
 		}
 
 		size_t length() const {
-			return _length;
+			unsigned char tag = getTag();
+			return tag <= InlineCapacity ? InlineCapacity - tag : _chars.length;
 		}
 
 		bool isEmpty() const {
-			return _length == 0;
+			return length() == 0;
 		}
 
 		const char *buffer() const {
-			return _buffer;
+			return getTag() <= InlineCapacity ? _inline : _chars.buffer;
+		}
+
+		/// True if the characters are shared through the intern table.
+		bool isInterned() const {
+			return getTag() == Tag_Interned;
 		}
 
 		void own(const String &other) {
 			if (this == &other) return;
-			if (_buffer) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
-			_length = other._length;
-			_buffer = other._buffer;
-			other._length = 0;
-			other._buffer = NULL;
+			release();
+			memcpy(_inline, other._inline, sizeof(_inline));
+			other.setNull();
 		}
 
+		/// Takes ownership of the specified characters, which must have been allocated with SpineExtension. They are freed
+		/// right away if they are stored inline or interned instead.
 		void own(const char *chars) {
-			if (_buffer == chars) return;
-			if (_buffer) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
-
-			if (!chars) {
-				_length = 0;
-				_buffer = NULL;
+			if (buffer() == chars) return;
+			release();
+			if (!chars) return;
+			size_t length = strlen(chars);
+			if (length <= InlineCapacity || _interning) {
+				set(chars, length);
+				SpineExtension::free(chars, __FILE__, __LINE__);
 			} else {
-				_length = strlen(chars);
-				_buffer = (char *) chars;
+				setChars((char *) chars, length, Tag_Heap);
 			}
 		}
 
 		void unown() {
-			_length = 0;
-			_buffer = NULL;
+			setNull();
 		}
 
 		String &operator=(const String &other) {
 			if (this == &other) return *this;
-			if (_buffer) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
-			if (!other._buffer) {
-				_length = 0;
-				_buffer = NULL;
-			} else {
-				_length = other._length;
-				_buffer = SpineExtension::calloc<char>(other._length + 1, __FILE__, __LINE__);
-				memcpy((void *) _buffer, other._buffer, other._length + 1);
-			}
+			release();
+			copy(other);
+			return *this;
+		}
+
+		String &operator=(String &&other) {
+			own(other);
 			return *this;
 		}
 
 		String &operator=(const char *chars) {
-			if (_buffer == chars) return *this;
-			if (_buffer) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
-			if (!chars) {
-				_length = 0;
-				_buffer = NULL;
-			} else {
-				_length = strlen(chars);
-				_buffer = SpineExtension::calloc<char>(_length + 1, __FILE__, __LINE__);
-				memcpy((void *) _buffer, chars, _length + 1);
-			}
+			if (buffer() == chars) return *this;
+			String other(chars);
+			own(other);
 			return *this;
 		}
 
 		String &append(const char *chars) {
-			size_t len = strlen(chars);
-			size_t thisLen = _length;
-			_length = _length + len;
-			bool same = chars == _buffer;
-			_buffer = SpineExtension::realloc(_buffer, _length + 1, __FILE__, __LINE__);
-			memcpy((void *) (_buffer + thisLen), (void *) (same ? _buffer : chars), len + 1);
+			append(chars, strlen(chars));
 			return *this;
 		}
 
 		String &append(const String &other) {
-			size_t len = other.length();
-			size_t thisLen = _length;
-			_length = _length + len;
-			bool same = other._buffer == _buffer;
-			_buffer = SpineExtension::realloc(_buffer, _length + 1, __FILE__, __LINE__);
-			memcpy((void *) (_buffer + thisLen), (void *) (same ? _buffer : other._buffer), len + 1);
+			append(other.buffer(), other.length());
 			return *this;
 		}
 
@@ -179,17 +152,24 @@ namespace spine {
 
 		bool startsWith(const String &needle) {
 			if (needle.length() > length()) return false;
+			const char *chars = buffer(), *needleChars = needle.buffer();
 			for (int i = 0; i < (int)needle.length(); i++) {
-				if (buffer()[i] != needle.buffer()[i]) return false;
+				if (chars[i] != needleChars[i]) return false;
 			}
 			return true;
 		}
 
 		friend bool operator==(const String &a, const String &b) {
-			if (a._buffer == b._buffer) return true;
-			if (a._length != b._length) return false;
-			if (a._buffer && b._buffer) {
-				return strcmp(a._buffer, b._buffer) == 0;
+			unsigned char aTag = a.getTag(), bTag = b.getTag();
+			// Strings are inline exactly when they fit, and inline strings are zero padded.
+			if (aTag <= InlineCapacity || bTag <= InlineCapacity)
+				return aTag == bTag && memcmp(a._inline, b._inline, InlineCapacity) == 0;
+			if (a._chars.buffer == b._chars.buffer) return true;
+			if (a._chars.length != b._chars.length) return false;
+			// Interned strings with the same characters share them.
+			if (aTag == Tag_Interned && bTag == Tag_Interned) return false;
+			if (a._chars.buffer && b._chars.buffer) {
+				return memcmp(a._chars.buffer, b._chars.buffer, a._chars.length) == 0;
 			} else {
 				return false;
 			}
@@ -200,14 +180,121 @@ namespace spine {
 		}
 
 		~String() {
-			if (_buffer) {
-				SpineExtension::free(_buffer, __FILE__, __LINE__);
-			}
+			release();
 		}
 
+		/// When true, strings longer than the inline capacity that are created from characters or from a string that is
+		/// not interned share their characters with equal interned strings, and strings that are both interned are
+		/// compared by pointer. Enable this before loading skeleton data to share bone, slot, attachment, skin, animation
+		/// and event names between skeleton data instances and the objects copying them. Interned characters are freed
+		/// when the last string using them is destroyed. The intern table is not synchronized, strings must not be
+		/// created, copied or destroyed on other threads while interning is enabled or interned strings exist. Default is
+		/// false.
+		static void setInterning(bool interning);
+
+		static bool getInterning();
+
+		/// Returns the number of distinct interned strings.
+		static size_t getInternedCount();
+
 	private:
-		mutable size_t _length;
-		mutable char *_buffer;
+		static const size_t InlineCapacity = 15;
+
+		// The last inline byte is the tag. For inline strings it is the unused capacity, so it is also the terminating
+		// null when all of the capacity is used. Inline strings are padded with zeros.
+		enum Tag {
+			Tag_Null = InlineCapacity + 1, Tag_Heap, Tag_Interned
+		};
+
+		struct Chars {
+			char *buffer;
+			unsigned int length;
+		};
+
+		union {
+			mutable Chars _chars;
+			mutable char _inline[InlineCapacity + 1];
+		};
+
+		static bool _interning;
+
+		unsigned char getTag() const {
+			return (unsigned char) _inline[InlineCapacity];
+		}
+
+		void setTag(unsigned char tag) const {
+			_inline[InlineCapacity] = (char) tag;
+		}
+
+		void setNull() const {
+			memset(_inline, 0, sizeof(_inline));
+			setTag(Tag_Null);
+		}
+
+		void setChars(char *chars, size_t length, Tag tag) const {
+			_chars.buffer = chars;
+			_chars.length = (unsigned int) length;
+			setTag(tag);
+		}
+
+		/// Stores the characters inline, interned or allocated. The string must be null.
+		void set(const char *chars, size_t length) {
+			if (length <= InlineCapacity) {
+				memcpy(_inline, chars, length);
+				memset(_inline + length, 0, InlineCapacity - length);
+				setTag((unsigned char) (InlineCapacity - length));
+			} else if (_interning) {
+				setChars(intern(chars, length), length, Tag_Interned);
+			} else {
+				char *buffer = SpineExtension::alloc<char>(length + 1, __FILE__, __LINE__);
+				memcpy(buffer, chars, length);
+				buffer[length] = 0;
+				setChars(buffer, length, Tag_Heap);
+			}
+		}
+
+		/// Shares interned characters, otherwise copies them. The string must be null.
+		void copy(const String &other) {
+			unsigned char tag = other.getTag();
+			if (tag == Tag_Interned) {
+				retainInterned(other._chars.buffer);
+				setChars(other._chars.buffer, other._chars.length, Tag_Interned);
+			} else if (tag != Tag_Null) {
+				set(other.buffer(), other.length());
+			}
+		}
+
+		void append(const char *chars, size_t length) {
+			size_t oldLength = this->length(), newLength = oldLength + length;
+			if (newLength <= InlineCapacity) {
+				// The string is inline or null, chars may be its own characters. The padding is already zero.
+				memmove(_inline + oldLength, chars, length);
+				_inline[newLength] = 0;
+				setTag((unsigned char) (InlineCapacity - newLength));
+				return;
+			}
+			char *buffer = SpineExtension::alloc<char>(newLength + 1, __FILE__, __LINE__);
+			memcpy(buffer, this->buffer(), oldLength);
+			memcpy(buffer + oldLength, chars, length);
+			buffer[newLength] = 0;
+			release();
+			setChars(buffer, newLength, Tag_Heap);
+		}
+
+		void release() {
+			unsigned char tag = getTag();
+			if (tag == Tag_Heap)
+				SpineExtension::free(_chars.buffer, __FILE__, __LINE__);
+			else if (tag == Tag_Interned)
+				releaseInterned(_chars.buffer);
+			setNull();
+		}
+
+		static char *intern(const char *chars, size_t length);
+
+		static void retainInterned(char *chars);
+
+		static void releaseInterned(char *chars);
 	};
 }
 
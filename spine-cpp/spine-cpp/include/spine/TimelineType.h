@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_TimelineType_h
+#define Spine_TimelineType_h
+
+namespace spine {
+	/// The concrete type of a timeline, used to group timelines in Animation::getTimelineGroups(). Types are listed in
+	/// the order the skeleton loaders create timelines, so a timeline never depends on one of a later type.
+	enum TimelineType {
+		TimelineType_Attachment = 0,
+		TimelineType_RGBA,
+		TimelineType_RGB,
+		TimelineType_RGBA2,
+		TimelineType_RGB2,
+		TimelineType_Alpha,
+		TimelineType_Rotate,
+		TimelineType_Translate,
+		TimelineType_TranslateX,
+		TimelineType_TranslateY,
+		TimelineType_Scale,
+		TimelineType_ScaleX,
+		TimelineType_ScaleY,
+		TimelineType_Shear,
+		TimelineType_ShearX,
+		TimelineType_ShearY,
+		TimelineType_IkConstraint,
+		TimelineType_TransformConstraint,
+		TimelineType_PathConstraintPosition,
+		TimelineType_PathConstraintSpacing,
+		TimelineType_PathConstraintMix,
+		TimelineType_Deform,
+		TimelineType_Sequence,
+		TimelineType_DrawOrder,
+		TimelineType_Event,
+		/// A timeline class not known to the runtime, applied with a virtual call.
+		TimelineType_Other
+	};
+}
+
+#endif /* Spine_TimelineType_h */
@@ -46,6 +46,8 @@ namespace spine {
 
 		friend class TransformConstraintTimeline;
 
+		friend class SkeletonPose;
+
 	RTTI_DECL
 
 	public:
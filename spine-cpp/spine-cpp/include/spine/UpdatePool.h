@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_UpdatePool_h
+#define Spine_UpdatePool_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+#ifndef SPINE_NO_THREADS
+
+namespace spine {
+	class Updatable;
+
+	/// Threads used by Skeleton::updateWorldTransform() to update bones and constraints that don't depend on each other
+	/// concurrently. See Skeleton::setUpdatePool(). A pool can be shared by many skeletons, skeletons updated on
+	/// different threads at the same time take turns.
+	///
+	/// Not available when SPINE_NO_THREADS is defined, for targets without std::thread.
+	class SP_API UpdatePool : public SpineObject {
+	public:
+		/// Updatables from the update cache that run on the calling thread if threads is 1, otherwise split into that many
+		/// contiguous ranges that run concurrently.
+		struct Stage {
+			int start, end, threads;
+		};
+
+		/// @param numThreads The number of threads updating a skeleton, including the thread calling
+		/// Skeleton::updateWorldTransform().
+		/// @param minUpdatablesPerThread Updatables that can run concurrently are only split across threads when each
+		/// thread gets at least this many, as waking and synchronizing threads costs more than updating a few bones.
+		explicit UpdatePool(int numThreads, int minUpdatablesPerThread = 32);
+
+		/// Waits for the threads to exit.
+		~UpdatePool();
+
+		int getThreadCount() { return _threadCount; }
+
+		int getMinUpdatablesPerThread() { return _minUpdatablesPerThread; }
+
+		/// Runs the stages in order, waiting for each to complete before starting the next.
+		void update(Vector<Updatable *> &updatables, Vector<Stage> &stages);
+
+	private:
+		struct Shared;
+
+		Shared *_shared;
+		int _threadCount;
+		int _minUpdatablesPerThread;
+
+		static void work(Shared *shared, int thread);
+
+		static void run(Shared *shared, int thread);
+	};
+}
+
+#endif
+
+#endif /* Spine_UpdatePool_h */
@@ -34,8 +34,44 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <assert.h>
+#include <string.h>
+#include <utility>
 
 namespace spine {
+	/// True if T can be copied with memcpy(). Vector uses this to copy, fill and remove elements in bulk.
+	template<typename T>
+	struct IsTriviallyCopyable {
+		static const bool value = false;
+	};
+
+	template<typename T>
+	struct IsTriviallyCopyable<T *> {
+		static const bool value = true;
+	};
+
+#define SP_TRIVIALLY_COPYABLE(T) \
+	template<> \
+	struct IsTriviallyCopyable<T> { \
+		static const bool value = true; \
+	};
+
+	SP_TRIVIALLY_COPYABLE(bool)
+	SP_TRIVIALLY_COPYABLE(char)
+	SP_TRIVIALLY_COPYABLE(signed char)
+	SP_TRIVIALLY_COPYABLE(unsigned char)
+	SP_TRIVIALLY_COPYABLE(short)
+	SP_TRIVIALLY_COPYABLE(unsigned short)
+	SP_TRIVIALLY_COPYABLE(int)
+	SP_TRIVIALLY_COPYABLE(unsigned int)
+	SP_TRIVIALLY_COPYABLE(long)
+	SP_TRIVIALLY_COPYABLE(unsigned long)
+	SP_TRIVIALLY_COPYABLE(long long)
+	SP_TRIVIALLY_COPYABLE(unsigned long long)
+	SP_TRIVIALLY_COPYABLE(float)
+	SP_TRIVIALLY_COPYABLE(double)
+
+#undef SP_TRIVIALLY_COPYABLE
+
 	template<typename T>
 	class SP_API Vector : public SpineObject {
 	public:
@@ -45,20 +81,50 @@ namespace spine {
 		Vector(const Vector &inVector) : _size(inVector._size), _capacity(inVector._capacity), _buffer(NULL) {
 			if (_capacity > 0) {
 				_buffer = allocate(_capacity);
-				for (size_t i = 0; i < _size; ++i) {
-					construct(_buffer + i, inVector._buffer[i]);
-				}
+				constructAll(_buffer, inVector._buffer, _size);
 			}
 		}
 
+		Vector(Vector &&inVector) : _size(inVector._size), _capacity(inVector._capacity), _buffer(inVector._buffer) {
+			inVector._size = 0;
+			inVector._capacity = 0;
+			inVector._buffer = NULL;
+		}
+
 		~Vector() {
 			clear();
 			deallocate(_buffer);
 		}
 
+		Vector &operator=(const Vector &inVector) {
+			if (this != &inVector) {
+				clear();
+				ensureCapacity(inVector._size);
+				constructAll(_buffer, inVector._buffer, inVector._size);
+				_size = inVector._size;
+			}
+			return *this;
+		}
+
+		Vector &operator=(Vector &&inVector) {
+			if (this != &inVector) {
+				clear();
+				deallocate(_buffer);
+				_size = inVector._size;
+				_capacity = inVector._capacity;
+				_buffer = inVector._buffer;
+				inVector._size = 0;
+				inVector._capacity = 0;
+				inVector._buffer = NULL;
+			}
+			return *this;
+		}
+
 		inline void clear() {
-			for (size_t i = 0; i < _size; ++i) {
-				destroy(_buffer + (_size - 1 - i));
+			if (!IsTriviallyCopyable<T>::value) {
+				for (size_t i = 0; i < _size; ++i) {
+					destroy(_buffer + (_size - 1 - i));
+				}
 			}
 
 			_size = 0;
@@ -82,8 +148,12 @@ namespace spine {
 				_buffer = spine::SpineExtension::realloc<T>(_buffer, _capacity, __FILE__, __LINE__);
 			}
 			if (oldSize < _size) {
-				for (size_t i = oldSize; i < _size; i++) {
-					construct(_buffer + i, defaultValue);
+				if (IsTriviallyCopyable<T>::value && isZero(defaultValue)) {
+					memset((void *) (_buffer + oldSize), 0, (_size - oldSize) * sizeof(T));
+				} else {
+					for (size_t i = oldSize; i < _size; i++) {
+						construct(_buffer + i, defaultValue);
+					}
 				}
 			}
 		}
@@ -94,6 +164,18 @@ namespace spine {
 			_buffer = SpineExtension::realloc<T>(_buffer, newCapacity, __FILE__, __LINE__);
 		}
 
+		inline void shrink() {
+			if (_capacity == _size) return;
+			if (_size == 0) {
+				deallocate(_buffer);
+				_buffer = NULL;
+				_capacity = 0;
+				return;
+			}
+			_capacity = _size;
+			_buffer = SpineExtension::realloc<T>(_buffer, _capacity, __FILE__, __LINE__);
+		}
+
 		inline void add(const T &inValue) {
 			if (_size == _capacity) {
 				// inValue might reference an element in this buffer
@@ -111,10 +193,10 @@ namespace spine {
 		}
 
 		inline void addAll(Vector<T> &inValue) {
-			ensureCapacity(this->size() + inValue.size());
-			for (size_t i = 0; i < inValue.size(); i++) {
-				add(inValue[i]);
-			}
+			size_t count = inValue._size;
+			ensureCapacity(_size + count);
+			constructAll(_buffer + _size, inValue._buffer, count);
+			_size += count;
 		}
 
 		inline void clearAndAddAll(Vector<T> &inValue) {
@@ -127,15 +209,10 @@ namespace spine {
 
 			--_size;
 
-			if (inIndex != _size) {
-				for (size_t i = inIndex; i < _size; ++i) {
-					T tmp(_buffer[i]);
-					_buffer[i] = _buffer[i + 1];
-					_buffer[i + 1] = tmp;
-				}
-			}
-
-			destroy(_buffer + _size);
+			// Elements are relocated bytewise, as realloc() already does when the buffer grows.
+			destroy(_buffer + inIndex);
+			if (inIndex != _size)
+				memmove((void *) (_buffer + inIndex), (void *) (_buffer + inIndex + 1), (_size - inIndex) * sizeof(T));
 		}
 
 		inline bool contains(const T &inValue) {
@@ -211,11 +288,24 @@ namespace spine {
 			new(buffer) T(val);
 		}
 
+		inline void constructAll(T *buffer, const T *values, size_t count) {
+			if (IsTriviallyCopyable<T>::value) {
+				if (count > 0) memcpy((void *) buffer, (const void *) values, count * sizeof(T));
+			} else {
+				for (size_t i = 0; i < count; ++i) {
+					construct(buffer + i, values[i]);
+				}
+			}
+		}
+
+		static inline bool isZero(const T &value) {
+			static const unsigned char zero[sizeof(T)] = {0};
+			return memcmp((const void *) &value, zero, sizeof(T)) == 0;
+		}
+
 		inline void destroy(T *buffer) {
 			buffer->~T();
 		}
-
-		// Vector &operator=(const Vector &inVector) {};
 	};
 }
 
@@ -31,8 +31,10 @@
 #define SPINE_SPINE_H_
 
 #include <spine/Animation.h>
+#include <spine/AnimationBounds.h>
 #include <spine/AnimationState.h>
 #include <spine/AnimationStateData.h>
+#include <spine/AsyncLoader.h>
 #include <spine/Atlas.h>
 #include <spine/AtlasAttachmentLoader.h>
 #include <spine/Attachment.h>
@@ -75,6 +77,7 @@
 #include <spine/PointAttachment.h>
 #include <spine/Pool.h>
 #include <spine/PositionMode.h>
+#include <spine/ProfilerExtension.h>
 #include <spine/RegionAttachment.h>
 #include <spine/RotateMode.h>
 #include <spine/RotateTimeline.h>
@@ -84,10 +87,14 @@
 #include <spine/Skeleton.h>
 #include <spine/SkeletonBinary.h>
 #include <spine/SkeletonBounds.h>
+#include <spine/SkeletonBoundsGrid.h>
 #include <spine/SkeletonClipping.h>
 #include <spine/SkeletonData.h>
 #include <spine/SkeletonJson.h>
+#include <spine/SkeletonPose.h>
+#include <spine/SkeletonRenderer.h>
 #include <spine/Skin.h>
+#include <spine/SkinningData.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
 #include <spine/SpacingMode.h>
@@ -95,6 +102,7 @@
 #include <spine/SpineString.h>
 #include <spine/TextureLoader.h>
 #include <spine/Timeline.h>
+#include <spine/TimelineType.h>
 #include <spine/Property.h>
 #include <spine/TransformConstraint.h>
 #include <spine/TransformConstraintData.h>
@@ -103,6 +111,7 @@
 #include <spine/TranslateTimeline.h>
 #include <spine/Triangulator.h>
 #include <spine/Updatable.h>
+#include <spine/UpdatePool.h>
 #include <spine/Vector.h>
 #include <spine/VertexAttachment.h>
 #include <spine/Vertices.h>
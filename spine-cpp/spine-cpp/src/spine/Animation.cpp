@@ -28,9 +28,24 @@
  *****************************************************************************/
 
 #include <spine/Animation.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/ColorTimeline.h>
+#include <spine/DeformTimeline.h>
+#include <spine/DrawOrderTimeline.h>
 #include <spine/Event.h>
+#include <spine/EventTimeline.h>
+#include <spine/IkConstraintTimeline.h>
+#include <spine/PathConstraintMixTimeline.h>
+#include <spine/PathConstraintPositionTimeline.h>
+#include <spine/PathConstraintSpacingTimeline.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/SequenceTimeline.h>
+#include <spine/ShearTimeline.h>
 #include <spine/Skeleton.h>
 #include <spine/Timeline.h>
+#include <spine/TransformConstraintTimeline.h>
+#include <spine/TranslateTimeline.h>
 
 #include <spine/ContainerUtil.h>
 
@@ -38,6 +53,48 @@
 
 using namespace spine;
 
+static TimelineType getTimelineType(Timeline *timeline) {
+	const RTTI &rtti = timeline->getRTTI();
+	if (rtti.isExactly(AttachmentTimeline::rtti)) return TimelineType_Attachment;
+	if (rtti.isExactly(RGBATimeline::rtti)) return TimelineType_RGBA;
+	if (rtti.isExactly(RGBTimeline::rtti)) return TimelineType_RGB;
+	if (rtti.isExactly(RGBA2Timeline::rtti)) return TimelineType_RGBA2;
+	if (rtti.isExactly(RGB2Timeline::rtti)) return TimelineType_RGB2;
+	if (rtti.isExactly(AlphaTimeline::rtti)) return TimelineType_Alpha;
+	if (rtti.isExactly(RotateTimeline::rtti)) return TimelineType_Rotate;
+	if (rtti.isExactly(TranslateTimeline::rtti)) return TimelineType_Translate;
+	if (rtti.isExactly(TranslateXTimeline::rtti)) return TimelineType_TranslateX;
+	if (rtti.isExactly(TranslateYTimeline::rtti)) return TimelineType_TranslateY;
+	if (rtti.isExactly(ScaleTimeline::rtti)) return TimelineType_Scale;
+	if (rtti.isExactly(ScaleXTimeline::rtti)) return TimelineType_ScaleX;
+	if (rtti.isExactly(ScaleYTimeline::rtti)) return TimelineType_ScaleY;
+	if (rtti.isExactly(ShearTimeline::rtti)) return TimelineType_Shear;
+	if (rtti.isExactly(ShearXTimeline::rtti)) return TimelineType_ShearX;
+	if (rtti.isExactly(ShearYTimeline::rtti)) return TimelineType_ShearY;
+	if (rtti.isExactly(IkConstraintTimeline::rtti)) return TimelineType_IkConstraint;
+	if (rtti.isExactly(TransformConstraintTimeline::rtti)) return TimelineType_TransformConstraint;
+	if (rtti.isExactly(PathConstraintPositionTimeline::rtti)) return TimelineType_PathConstraintPosition;
+	if (rtti.isExactly(PathConstraintSpacingTimeline::rtti)) return TimelineType_PathConstraintSpacing;
+	if (rtti.isExactly(PathConstraintMixTimeline::rtti)) return TimelineType_PathConstraintMix;
+	if (rtti.isExactly(DeformTimeline::rtti)) return TimelineType_Deform;
+	if (rtti.isExactly(SequenceTimeline::rtti)) return TimelineType_Sequence;
+	if (rtti.isExactly(DrawOrderTimeline::rtti)) return TimelineType_DrawOrder;
+	if (rtti.isExactly(EventTimeline::rtti)) return TimelineType_Event;
+	return TimelineType_Other;
+}
+
+// The qualified call binds statically, so the loop has no virtual call and the calls of a group share one call site.
+template<typename T>
+static void applyTimelines(Timeline **timelines, const int *indices, size_t count, Skeleton &skeleton, float lastTime,
+						   float time, Vector<Event *> *pEvents, float alpha, const float *alphas, MixBlend blend,
+						   const MixBlend *blends, MixDirection direction) {
+	for (size_t i = 0; i < count; i++) {
+		int index = indices[i];
+		static_cast<T *>(timelines[i])->T::apply(skeleton, lastTime, time, pEvents, alphas ? alphas[index] : alpha,
+												 blends ? blends[index] : blend, direction);
+	}
+}
+
 Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(timelines),
 																						  _timelineIds(),
 																						  _duration(duration),
@@ -48,6 +105,7 @@ Animation::Animation(const String &name, Vector<Timeline *> &timelines, float du
 		for (size_t ii = 0; ii < propertyIds.size(); ii++)
 			_timelineIds.put(propertyIds[ii], true);
 	}
+	groupTimelines();
 }
 
 bool Animation::hasTimeline(Vector<PropertyId> &ids) {
@@ -70,8 +128,123 @@ void Animation::apply(Skeleton &skeleton, float lastTime, float time, bool loop,
 		}
 	}
 
-	for (size_t i = 0, n = _timelines.size(); i < n; ++i) {
-		_timelines[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
+	for (size_t i = 0, n = _timelineGroups.size(); i < n; ++i)
+		applyGroup(_timelineGroups[i], skeleton, lastTime, time, pEvents, alpha, NULL, blend, NULL, direction);
+}
+
+void Animation::applyGroup(TimelineGroup &group, Skeleton &skeleton, float lastTime, float time,
+						   Vector<Event *> *pEvents, float alpha, const float *alphas, MixBlend blend,
+						   const MixBlend *blends, MixDirection direction) {
+	Timeline **timelines = _groupedTimelines.buffer() + group.start;
+	const int *indices = _groupedIndices.buffer() + group.start;
+	size_t count = group.count;
+	switch (group.type) {
+		case TimelineType_Attachment:
+			applyTimelines<AttachmentTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha,
+											   alphas, blend, blends, direction);
+			break;
+		case TimelineType_RGBA:
+			applyTimelines<RGBATimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										 blend, blends, direction);
+			break;
+		case TimelineType_RGB:
+			applyTimelines<RGBTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										blend, blends, direction);
+			break;
+		case TimelineType_RGBA2:
+			applyTimelines<RGBA2Timeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										  blend, blends, direction);
+			break;
+		case TimelineType_RGB2:
+			applyTimelines<RGB2Timeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										 blend, blends, direction);
+			break;
+		case TimelineType_Alpha:
+			applyTimelines<AlphaTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										  blend, blends, direction);
+			break;
+		case TimelineType_Rotate:
+			applyTimelines<RotateTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										   blend, blends, direction);
+			break;
+		case TimelineType_Translate:
+			applyTimelines<TranslateTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha,
+											  alphas, blend, blends, direction);
+			break;
+		case TimelineType_TranslateX:
+			applyTimelines<TranslateXTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha,
+											   alphas, blend, blends, direction);
+			break;
+		case TimelineType_TranslateY:
+			applyTimelines<TranslateYTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha,
+											   alphas, blend, blends, direction);
+			break;
+		case TimelineType_Scale:
+			applyTimelines<ScaleTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										  blend, blends, direction);
+			break;
+		case TimelineType_ScaleX:
+			applyTimelines<ScaleXTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										   blend, blends, direction);
+			break;
+		case TimelineType_ScaleY:
+			applyTimelines<ScaleYTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										   blend, blends, direction);
+			break;
+		case TimelineType_Shear:
+			applyTimelines<ShearTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										  blend, blends, direction);
+			break;
+		case TimelineType_ShearX:
+			applyTimelines<ShearXTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										   blend, blends, direction);
+			break;
+		case TimelineType_ShearY:
+			applyTimelines<ShearYTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										   blend, blends, direction);
+			break;
+		case TimelineType_IkConstraint:
+			applyTimelines<IkConstraintTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha,
+												 alphas, blend, blends, direction);
+			break;
+		case TimelineType_TransformConstraint:
+			applyTimelines<TransformConstraintTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents,
+														alpha, alphas, blend, blends, direction);
+			break;
+		case TimelineType_PathConstraintPosition:
+			applyTimelines<PathConstraintPositionTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents,
+														   alpha, alphas, blend, blends, direction);
+			break;
+		case TimelineType_PathConstraintSpacing:
+			applyTimelines<PathConstraintSpacingTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents,
+														  alpha, alphas, blend, blends, direction);
+			break;
+		case TimelineType_PathConstraintMix:
+			applyTimelines<PathConstraintMixTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents,
+													  alpha, alphas, blend, blends, direction);
+			break;
+		case TimelineType_Deform:
+			applyTimelines<DeformTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										   blend, blends, direction);
+			break;
+		case TimelineType_Sequence:
+			applyTimelines<SequenceTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha,
+											 alphas, blend, blends, direction);
+			break;
+		case TimelineType_DrawOrder:
+			applyTimelines<DrawOrderTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha,
+											  alphas, blend, blends, direction);
+			break;
+		case TimelineType_Event:
+			applyTimelines<EventTimeline>(timelines, indices, count, skeleton, lastTime, time, pEvents, alpha, alphas,
+										  blend, blends, direction);
+			break;
+		default:
+			for (size_t i = 0; i < count; i++) {
+				int index = indices[i];
+				timelines[i]->apply(skeleton, lastTime, time, pEvents, alphas ? alphas[index] : alpha,
+									blends ? blends[index] : blend, direction);
+			}
 	}
 }
 
@@ -83,6 +256,60 @@ Vector<Timeline *> &Animation::getTimelines() {
 	return _timelines;
 }
 
+void Animation::groupTimelines() {
+	size_t n = _timelines.size();
+	_timelineTypes.clear();
+	_groupedTimelines.clear();
+	_groupedIndices.clear();
+	_timelineGroups.clear();
+	_timelineTypes.ensureCapacity(n);
+	_groupedTimelines.ensureCapacity(n);
+	_groupedIndices.ensureCapacity(n);
+
+	bool known = true;
+	for (size_t i = 0; i < n; i++) {
+		TimelineType type = getTimelineType(_timelines[i]);
+		if (type == TimelineType_Other) known = false;
+		_timelineTypes.add(type);
+	}
+
+	if (known) {
+		for (int type = 0; type < TimelineType_Other; type++) {
+			for (size_t i = 0; i < n; i++)
+				if (_timelineTypes[i] == type) addGroupedTimeline(i);
+		}
+	} else {
+		// A timeline of an unknown type may depend on any other timeline, so the order can't change.
+		for (size_t i = 0; i < n; i++)
+			addGroupedTimeline(i);
+	}
+}
+
+void Animation::addGroupedTimeline(size_t index) {
+	TimelineType type = _timelineTypes[index];
+	size_t groupCount = _timelineGroups.size();
+	if (groupCount == 0 || _timelineGroups[groupCount - 1].type != type) {
+		TimelineGroup group = {type, _groupedTimelines.size(), 0};
+		_timelineGroups.add(group);
+		groupCount++;
+	}
+	_timelineGroups[groupCount - 1].count++;
+	_groupedTimelines.add(_timelines[index]);
+	_groupedIndices.add((int) index);
+}
+
+Vector<Timeline *> &Animation::getGroupedTimelines() {
+	return _groupedTimelines;
+}
+
+Vector<int> &Animation::getGroupedIndices() {
+	return _groupedIndices;
+}
+
+Vector<TimelineGroup> &Animation::getTimelineGroups() {
+	return _timelineGroups;
+}
+
 float Animation::getDuration() {
 	return _duration;
 }
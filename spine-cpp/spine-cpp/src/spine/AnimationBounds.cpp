@@ -0,0 +1,213 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/AnimationBounds.h>
+
+#include <spine/Animation.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+#include <spine/Timeline.h>
+
+#include <float.h>
+#include <stdlib.h>
+
+using namespace spine;
+
+static int compareEntries(const void *a, const void *b) {
+	size_t animationA = (size_t) *(Animation *const *) a, animationB = (size_t) *(Animation *const *) b;
+	return animationA < animationB ? -1 : (animationA > animationB ? 1 : 0);
+}
+
+static int compareTimes(const void *a, const void *b) {
+	float timeA = *(const float *) a, timeB = *(const float *) b;
+	return timeA < timeB ? -1 : (timeA > timeB ? 1 : 0);
+}
+
+static void computeBounds(Skeleton &skeleton, Vector<float> &vertices, float *bounds) {
+	float x, y, width, height;
+	skeleton.getBounds(x, y, width, height, vertices);
+	bounds[0] = x;
+	bounds[1] = y;
+	bounds[2] = x + width;
+	bounds[3] = y + height;
+}
+
+static void addBounds(float *bounds, const float *other) {
+	if (other[0] > other[2]) return;
+	bounds[0] = MathUtil::min(bounds[0], other[0]);
+	bounds[1] = MathUtil::min(bounds[1], other[1]);
+	bounds[2] = MathUtil::max(bounds[2], other[2]);
+	bounds[3] = MathUtil::max(bounds[3], other[3]);
+}
+
+AnimationBounds::AnimationBounds(SkeletonData *skeletonData, Skin *skin, float sampleInterval, float segmentDuration)
+	: _skeletonData(skeletonData), _skin(skin), _segmentDuration(segmentDuration), _padding(0) {
+	assert(sampleInterval > 0);
+	assert(segmentDuration > 0);
+
+	Skeleton skeleton(skeletonData);
+	if (skin) skeleton.setSkin(skin);
+	skeleton.setToSetupPose();
+	skeleton.updateWorldTransform();
+	Vector<float> vertices;
+	computeBounds(skeleton, vertices, _setupBounds);
+
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	Vector<float> times, samples;
+	for (size_t i = 0, n = animations.size(); i < n; i++) {
+		Animation *animation = animations[i];
+		float duration = animation->getDuration();
+
+		// Sample at regular intervals and at every key frame.
+		times.clear();
+		for (int ii = 0, nn = (int) (duration / sampleInterval); ii <= nn; ii++)
+			times.add(ii * sampleInterval);
+		times.add(duration);
+		Vector<Timeline *> &timelines = animation->getTimelines();
+		for (size_t ii = 0, nn = timelines.size(); ii < nn; ii++) {
+			Vector<float> &frames = timelines[ii]->getFrames();
+			for (size_t frame = 0, entries = timelines[ii]->getFrameEntries(); frame < frames.size(); frame += entries)
+				if (frames[frame] <= duration) times.add(frames[frame]);
+		}
+		qsort(times.buffer(), times.size(), sizeof(float), compareTimes);
+
+		samples.setSize(times.size() * 4, 0);
+		for (size_t ii = 0, nn = times.size(); ii < nn; ii++) {
+			skeleton.setToSetupPose();
+			animation->apply(skeleton, 0, times[ii], false, NULL, 1, MixBlend_Setup, MixDirection_In);
+			skeleton.updateWorldTransform();
+			computeBounds(skeleton, vertices, samples.buffer() + ii * 4);
+		}
+
+		Entry entry;
+		entry.animation = animation;
+		entry.offset = _bounds.size();
+		entry.segmentCount = (size_t) (duration / segmentDuration) + 1;
+		_bounds.setSize(entry.offset + entry.segmentCount * 4, 0);
+		float *segments = _bounds.buffer() + entry.offset;
+		for (size_t ii = 0; ii < entry.segmentCount; ii++) {
+			segments[ii * 4] = FLT_MAX;
+			segments[ii * 4 + 1] = FLT_MAX;
+			segments[ii * 4 + 2] = -FLT_MAX;
+			segments[ii * 4 + 3] = -FLT_MAX;
+		}
+
+		// Between two samples the skeleton is expected to stay within their bounds, expanded on each side by the distance that
+		// side moved from one sample to the next. That is added to every segment the time between the samples overlaps.
+		for (size_t ii = 0, nn = times.size(); ii < nn; ii++) {
+			const float *from = samples.buffer() + ii * 4;
+			const float *to = ii + 1 < nn ? from + 4 : from;
+			float interval[4];
+			if (from[0] > from[2]) {
+				if (to[0] > to[2]) continue;
+				from = to;
+			} else if (to[0] > to[2])
+				to = from;
+			interval[0] = MathUtil::min(from[0], to[0]) - MathUtil::abs(from[0] - to[0]);
+			interval[1] = MathUtil::min(from[1], to[1]) - MathUtil::abs(from[1] - to[1]);
+			interval[2] = MathUtil::max(from[2], to[2]) + MathUtil::abs(from[2] - to[2]);
+			interval[3] = MathUtil::max(from[3], to[3]) + MathUtil::abs(from[3] - to[3]);
+			size_t first = (size_t) (times[ii] / segmentDuration);
+			size_t last = (size_t) (times[ii + 1 < nn ? ii + 1 : ii] / segmentDuration);
+			if (last >= entry.segmentCount) last = entry.segmentCount - 1;
+			for (size_t segment = first; segment <= last; segment++)
+				addBounds(segments + segment * 4, interval);
+		}
+		_entries.add(entry);
+	}
+	if (_entries.size() > 1) qsort(_entries.buffer(), _entries.size(), sizeof(Entry), compareEntries);
+}
+
+AnimationBounds::~AnimationBounds() {
+}
+
+bool AnimationBounds::findBounds(Animation *animation, float time, const float *&outBounds) {
+	size_t low = 0, high = _entries.size();
+	while (low < high) {
+		size_t mid = (low + high) >> 1;
+		Entry &entry = _entries[mid];
+		if (entry.animation == animation) {
+			size_t segment = time > 0 ? (size_t) (time / _segmentDuration) : 0;
+			if (segment >= entry.segmentCount) segment = entry.segmentCount - 1;
+			outBounds = _bounds.buffer() + entry.offset + segment * 4;
+			return true;
+		}
+		if ((size_t) entry.animation < (size_t) animation)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return false;
+}
+
+void AnimationBounds::toBounds(const float *bounds, float &outX, float &outY, float &outWidth, float &outHeight) {
+	if (bounds[0] > bounds[2]) {
+		outX = 0;
+		outY = 0;
+		outWidth = 0;
+		outHeight = 0;
+		return;
+	}
+	outX = bounds[0] - _padding;
+	outY = bounds[1] - _padding;
+	outWidth = bounds[2] - bounds[0] + _padding * 2;
+	outHeight = bounds[3] - bounds[1] + _padding * 2;
+}
+
+bool AnimationBounds::getBounds(Animation *animation, float time, float &outX, float &outY, float &outWidth, float &outHeight) {
+	const float *bounds;
+	if (!findBounds(animation, time, bounds)) return false;
+	toBounds(bounds, outX, outY, outWidth, outHeight);
+	return true;
+}
+
+void AnimationBounds::getSetupBounds(float &outX, float &outY, float &outWidth, float &outHeight) {
+	toBounds(_setupBounds, outX, outY, outWidth, outHeight);
+}
+
+SkeletonData *AnimationBounds::getSkeletonData() {
+	return _skeletonData;
+}
+
+Skin *AnimationBounds::getSkin() {
+	return _skin;
+}
+
+float AnimationBounds::getSegmentDuration() {
+	return _segmentDuration;
+}
+
+float AnimationBounds::getPadding() {
+	return _padding;
+}
+
+void AnimationBounds::setPadding(float inValue) {
+	_padding = inValue;
+}
@@ -59,7 +59,7 @@ TrackEntry::TrackEntry() : _animation(NULL), _previous(NULL), _next(NULL), _mixi
 						   _eventThreshold(0), _attachmentThreshold(0), _drawOrderThreshold(0), _animationStart(0),
 						   _animationEnd(0), _animationLast(0), _nextAnimationLast(0), _delay(0), _trackTime(0),
 						   _trackLast(0), _nextTrackLast(0), _trackEnd(0), _timeScale(1.0f), _alpha(0), _mixTime(0),
-						   _mixDuration(0), _interruptAlpha(0), _totalAlpha(0), _mixBlend(MixBlend_Replace),
+						   _mixDuration(0), _interruptAlpha(0), _totalAlpha(0), _mixBlend(MixBlend_Replace), _serial(0),
 						   _listener(dummyOnAnimationEventFunc), _listenerObject(NULL) {
 }
 
@@ -318,6 +318,7 @@ AnimationState::AnimationState(AnimationStateData *data) : _data(data),
 														   _listener(dummyOnAnimationEventFunc),
 														   _listenerObject(NULL),
 														   _unkeyedState(0),
+														   _trackEntrySerial(0),
 														   _timeScale(1),
 														   _manualTrackEntryDisposal(false) {
 }
@@ -443,40 +444,51 @@ bool AnimationState::apply(Skeleton &skeleton) {
 			applyTime = current._animation->getDuration() - applyTime;
 			applyEvents = NULL;
 		}
-		size_t timelineCount = current._animation->_timelines.size();
-		Vector<Timeline *> &timelines = current._animation->_timelines;
+		Animation &animation = *current._animation;
+		size_t timelineCount = animation._timelines.size();
+		Vector<TimelineGroup> &groups = animation._timelineGroups;
+		Timeline **timelines = animation._groupedTimelines.buffer();
+		int *indices = animation._groupedIndices.buffer();
 		if ((i == 0 && mix == 1) || blend == MixBlend_Add) {
-			for (size_t ii = 0; ii < timelineCount; ++ii) {
-				Timeline *timeline = timelines[ii];
-				if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
-					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, blend,
-											true);
-				else
-					timeline->apply(skeleton, animationLast, applyTime, applyEvents, mix, blend, MixDirection_In);
+			for (size_t ii = 0, nn = groups.size(); ii < nn; ++ii) {
+				TimelineGroup &group = groups[ii];
+				if (group.type == TimelineType_Attachment) {
+					for (size_t iii = group.start, end = group.start + group.count; iii < end; ++iii)
+						applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timelines[iii]), skeleton, applyTime,
+												blend, true);
+				} else
+					animation.applyGroup(group, skeleton, animationLast, applyTime, applyEvents, mix, NULL, blend, NULL,
+										 MixDirection_In);
 			}
 		} else {
 			Vector<int> &timelineMode = current._timelineMode;
 
 			bool shortestRotation = current._shortestRotation;
-			bool firstFrame = !shortestRotation && current._timelinesRotation.size() != timelines.size() << 1;
-			if (firstFrame) current._timelinesRotation.setSize(timelines.size() << 1, 0);
+			bool firstFrame = !shortestRotation && current._timelinesRotation.size() != timelineCount << 1;
+			if (firstFrame) current._timelinesRotation.setSize(timelineCount << 1, 0);
 			Vector<float> &timelinesRotation = current._timelinesRotation;
 
-			for (size_t ii = 0; ii < timelineCount; ++ii) {
-				Timeline *timeline = timelines[ii];
-				assert(timeline);
-
-				MixBlend timelineBlend = timelineMode[ii] == Subsequent ? blend : MixBlend_Setup;
-
-				if (!shortestRotation && timeline->getRTTI().isExactly(RotateTimeline::rtti))
-					applyRotateTimeline(static_cast<RotateTimeline *>(timeline), skeleton, applyTime, mix,
-										timelineBlend, timelinesRotation, ii << 1, firstFrame);
-				else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
-					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime,
-											timelineBlend, true);
-				else
-					timeline->apply(skeleton, animationLast, applyTime, applyEvents, mix, timelineBlend,
-									MixDirection_In);
+			_timelineBlends.setSize(timelineCount, MixBlend_Setup);
+			MixBlend *timelineBlends = _timelineBlends.buffer();
+			for (size_t ii = 0; ii < timelineCount; ++ii)
+				timelineBlends[ii] = timelineMode[ii] == Subsequent ? blend : MixBlend_Setup;
+
+			for (size_t ii = 0, nn = groups.size(); ii < nn; ++ii) {
+				TimelineGroup &group = groups[ii];
+				size_t start = group.start, end = group.start + group.count;
+				if (group.type == TimelineType_Rotate && !shortestRotation) {
+					for (size_t iii = start; iii < end; ++iii) {
+						int index = indices[iii];
+						applyRotateTimeline(static_cast<RotateTimeline *>(timelines[iii]), skeleton, applyTime, mix,
+											timelineBlends[index], timelinesRotation, index << 1, firstFrame);
+					}
+				} else if (group.type == TimelineType_Attachment) {
+					for (size_t iii = start; iii < end; ++iii)
+						applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timelines[iii]), skeleton, applyTime,
+												timelineBlends[indices[iii]], true);
+				} else
+					animation.applyGroup(group, skeleton, animationLast, applyTime, applyEvents, mix, NULL, blend,
+										 timelineBlends, MixDirection_In);
 			}
 		}
 
@@ -678,6 +690,10 @@ void AnimationState::disposeTrackEntry(TrackEntry *entry) {
 	_trackEntryPool.free(entry);
 }
 
+void AnimationState::preallocateTrackEntries(size_t count) {
+	_trackEntryPool.preallocate(count);
+}
+
 Animation *AnimationState::getEmptyAnimation() {
 	static Vector<Timeline *> timelines;
 	static Animation ret(String("<empty>"), timelines, 0);
@@ -811,40 +827,48 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 	}
 
 	bool attachments = mix < from->_attachmentThreshold, drawOrder = mix < from->_drawOrderThreshold;
-	Vector<Timeline *> &timelines = from->_animation->_timelines;
-	size_t timelineCount = timelines.size();
+	Animation &animation = *from->_animation;
+	size_t timelineCount = animation._timelines.size();
+	Vector<TimelineGroup> &groups = animation._timelineGroups;
+	Timeline **timelines = animation._groupedTimelines.buffer();
+	int *indices = animation._groupedIndices.buffer();
 	float alphaHold = from->_alpha * to->_interruptAlpha, alphaMix = alphaHold * (1 - mix);
 	float animationLast = from->_animationLast, animationTime = from->getAnimationTime();
 	float applyTime = animationTime;
 	Vector<Event *> *events = NULL;
 	if (from->_reverse) {
-		applyTime = from->_animation->_duration - applyTime;
+		applyTime = animation._duration - applyTime;
 	} else {
 		if (mix < from->_eventThreshold) events = &_events;
 	}
 
 	if (blend == MixBlend_Add) {
-		for (size_t i = 0; i < timelineCount; i++)
-			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+		for (size_t i = 0, n = groups.size(); i < n; i++)
+			animation.applyGroup(groups[i], skeleton, animationLast, applyTime, events, alphaMix, NULL, blend, NULL,
+								 MixDirection_Out);
 	} else {
 		Vector<int> &timelineMode = from->_timelineMode;
 		Vector<TrackEntry *> &timelineHoldMix = from->_timelineHoldMix;
+		Vector<TimelineType> &timelineTypes = animation._timelineTypes;
 
 		bool shortestRotation = from->_shortestRotation;
-		bool firstFrame = !shortestRotation && from->_timelinesRotation.size() != timelines.size() << 1;
-		if (firstFrame) from->_timelinesRotation.setSize(timelines.size() << 1, 0);
+		bool firstFrame = !shortestRotation && from->_timelinesRotation.size() != timelineCount << 1;
+		if (firstFrame) from->_timelinesRotation.setSize(timelineCount << 1, 0);
 
 		Vector<float> &timelinesRotation = from->_timelinesRotation;
 
+		// Compute each timeline's alpha and blend in the original order, then apply the timelines group by group.
+		_timelineAlphas.setSize(timelineCount, 0);
+		_timelineBlends.setSize(timelineCount, MixBlend_Setup);
+		float *timelineAlphas = _timelineAlphas.buffer();
+		MixBlend *timelineBlends = _timelineBlends.buffer();
 		from->_totalAlpha = 0;
 		for (size_t i = 0; i < timelineCount; i++) {
-			Timeline *timeline = timelines[i];
-			MixDirection direction = MixDirection_Out;
 			MixBlend timelineBlend;
 			float alpha;
 			switch (timelineMode[i]) {
 				case Subsequent:
-					if (!drawOrder && (timeline->getRTTI().isExactly(DrawOrderTimeline::rtti))) continue;
+					if (!drawOrder && timelineTypes[i] == TimelineType_DrawOrder) continue;
 					timelineBlend = blend;
 					alpha = alphaMix;
 					break;
@@ -867,17 +891,46 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 					break;
 			}
 			from->_totalAlpha += alpha;
-			if (!shortestRotation && (timeline->getRTTI().isExactly(RotateTimeline::rtti))) {
-				applyRotateTimeline((RotateTimeline *) timeline, skeleton, applyTime, alpha, timelineBlend,
-									timelinesRotation, i << 1, firstFrame);
-			} else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti)) {
-				applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, timelineBlend,
-										attachments);
-			} else {
-				if (drawOrder && timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) &&
-					timelineBlend == MixBlend_Setup)
-					direction = MixDirection_In;
-				timeline->apply(skeleton, animationLast, applyTime, events, alpha, timelineBlend, direction);
+			timelineAlphas[i] = alpha;
+			timelineBlends[i] = timelineBlend;
+		}
+
+		for (size_t i = 0, n = groups.size(); i < n; i++) {
+			TimelineGroup &group = groups[i];
+			size_t start = group.start, end = group.start + group.count;
+			switch (group.type) {
+				case TimelineType_Rotate:
+					if (shortestRotation) {
+						animation.applyGroup(group, skeleton, animationLast, applyTime, events, 0, timelineAlphas,
+											 blend, timelineBlends, MixDirection_Out);
+						break;
+					}
+					for (size_t ii = start; ii < end; ii++) {
+						int index = indices[ii];
+						applyRotateTimeline(static_cast<RotateTimeline *>(timelines[ii]), skeleton, applyTime,
+											timelineAlphas[index], timelineBlends[index], timelinesRotation,
+											index << 1, firstFrame);
+					}
+					break;
+				case TimelineType_Attachment:
+					for (size_t ii = start; ii < end; ii++)
+						applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timelines[ii]), skeleton, applyTime,
+												timelineBlends[indices[ii]], attachments);
+					break;
+				case TimelineType_DrawOrder:
+					for (size_t ii = start; ii < end; ii++) {
+						int index = indices[ii];
+						if (!drawOrder && timelineMode[index] == Subsequent) continue;
+						MixBlend timelineBlend = timelineBlends[index];
+						MixDirection direction = drawOrder && timelineBlend == MixBlend_Setup ? MixDirection_In
+																							   : MixDirection_Out;
+						timelines[ii]->apply(skeleton, animationLast, applyTime, events, timelineAlphas[index],
+											 timelineBlend, direction);
+					}
+					break;
+				default:
+					animation.applyGroup(group, skeleton, animationLast, applyTime, events, 0, timelineAlphas, blend,
+										 timelineBlends, MixDirection_Out);
 			}
 		}
 	}
@@ -963,6 +1016,8 @@ TrackEntry *AnimationState::newTrackEntry(size_t trackIndex, Animation *animatio
 	TrackEntry *entryP = _trackEntryPool.obtain();// Pooling
 	TrackEntry &entry = *entryP;
 
+	// Identifies the entry across pool reuse, see SkeletonPose.
+	entry._serial = ++_trackEntrySerial;
 	entry._trackIndex = (int) trackIndex;
 	entry._animation = animation;
 	entry._loop = loop;
@@ -56,9 +56,8 @@ float AnimationStateData::getMix(Animation *from, Animation *to) {
 	assert(to != NULL);
 
 	AnimationPair key(from, to);
-
-	if (_animationToMixTime.containsKey(key)) return _animationToMixTime[key];
-	return _defaultMix;
+	float *duration = _animationToMixTime.get(key);
+	return duration ? *duration : _defaultMix;
 }
 
 SkeletonData *AnimationStateData::getSkeletonData() {
@@ -82,5 +81,5 @@ AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) :
 }
 
 bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
-	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
+	return (_a1 == other._a1 || _a1->_name == other._a1->_name) && (_a2 == other._a2 || _a2->_name == other._a2->_name);
 }
@@ -0,0 +1,233 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/AsyncLoader.h>
+
+#ifndef SPINE_NO_THREADS
+
+#include <spine/Atlas.h>
+#include <spine/SkeletonBinary.h>
+#include <spine/SkeletonData.h>
+#include <spine/SkeletonJson.h>
+#include <spine/Vector.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace spine;
+
+struct AsyncLoader::Load : public SpineObject {
+	int id;
+	String atlasPath;
+	String skeletonPath;
+	AsyncLoadCallback callback;
+	void *userData;
+	float scale;
+	bool cancelled;
+	Atlas *atlas;
+	SkeletonData *skeletonData;
+	String error;
+};
+
+struct AsyncLoader::Shared : public SpineObject {
+	std::mutex mutex;
+	std::condition_variable queued;
+	std::vector<std::thread> threads;
+	// Loads move from the queue to loading while a worker loads them, then to finished until update() takes them.
+	Vector<Load *> queue;
+	Vector<Load *> loading;
+	Vector<Load *> finished;
+	bool exit;
+
+	Shared() : exit(false) {
+	}
+};
+
+namespace {
+	bool isBinary(const String &path) {
+		size_t length = path.length();
+		return length >= 5 && strcmp(path.buffer() + length - 5, ".skel") == 0;
+	}
+}
+
+AsyncLoader::AsyncLoader(TextureLoader *textureLoader, int numThreads) : _textureLoader(textureLoader),
+																		 _shared(new (__FILE__, __LINE__) Shared()),
+																		 _nextId(0) {
+	if (numThreads < 1) numThreads = 1;
+	for (int i = 0; i < numThreads; i++)
+		_shared->threads.push_back(std::thread(work, _shared));
+}
+
+AsyncLoader::~AsyncLoader() {
+	{
+		std::lock_guard<std::mutex> lock(_shared->mutex);
+		_shared->exit = true;
+		for (size_t i = 0; i < _shared->queue.size(); i++)
+			dispose(_shared->queue[i]);
+		_shared->queue.clear();
+		// Workers dispose the loads they are working on when they see them cancelled.
+		for (size_t i = 0; i < _shared->loading.size(); i++)
+			_shared->loading[i]->cancelled = true;
+	}
+	_shared->queued.notify_all();
+	for (size_t i = 0; i < _shared->threads.size(); i++)
+		_shared->threads[i].join();
+	for (size_t i = 0; i < _shared->finished.size(); i++)
+		dispose(_shared->finished[i]);
+	delete _shared;
+}
+
+int AsyncLoader::load(const String &atlasPath, const String &skeletonPath, AsyncLoadCallback callback,
+					  void *userData, float scale) {
+	Load *load = new (__FILE__, __LINE__) Load();
+	load->id = _nextId++;
+	load->atlasPath = atlasPath;
+	load->skeletonPath = skeletonPath;
+	load->callback = callback;
+	load->userData = userData;
+	load->scale = scale;
+	load->cancelled = false;
+	load->atlas = NULL;
+	load->skeletonData = NULL;
+	{
+		std::lock_guard<std::mutex> lock(_shared->mutex);
+		_shared->queue.add(load);
+	}
+	_shared->queued.notify_one();
+	return load->id;
+}
+
+bool AsyncLoader::cancel(int id) {
+	std::lock_guard<std::mutex> lock(_shared->mutex);
+	Load *load = NULL;
+	auto remove = [id, &load](Vector<Load *> &loads) {
+		for (size_t i = 0, n = loads.size(); i < n; i++) {
+			if (loads[i]->id != id) continue;
+			load = loads[i];
+			loads.removeAt(i);
+			return true;
+		}
+		return false;
+	};
+	if (remove(_shared->queue) || remove(_shared->finished)) {
+		dispose(load);
+		return true;
+	}
+	for (size_t i = 0, n = _shared->loading.size(); i < n; i++) {
+		load = _shared->loading[i];
+		if (load->id != id || load->cancelled) continue;
+		load->cancelled = true;
+		return true;
+	}
+	return false;
+}
+
+int AsyncLoader::update() {
+	int count = 0;
+	while (true) {
+		Load *load;
+		{
+			std::lock_guard<std::mutex> lock(_shared->mutex);
+			if (_shared->finished.size() == 0) break;
+			load = _shared->finished[0];
+			_shared->finished.removeAt(0);
+		}
+		if (load->atlas) load->atlas->createTextures(_textureLoader);
+		load->callback(load->id, load->atlas, load->skeletonData, load->error, load->userData);
+		delete load;
+		count++;
+	}
+	return count;
+}
+
+int AsyncLoader::getPendingCount() {
+	std::lock_guard<std::mutex> lock(_shared->mutex);
+	int count = (int) (_shared->queue.size() + _shared->finished.size());
+	for (size_t i = 0, n = _shared->loading.size(); i < n; i++)
+		if (!_shared->loading[i]->cancelled) count++;
+	return count;
+}
+
+void AsyncLoader::work(Shared *shared) {
+	while (true) {
+		Load *load;
+		{
+			std::unique_lock<std::mutex> lock(shared->mutex);
+			shared->queued.wait(lock, [shared] { return shared->exit || shared->queue.size() > 0; });
+			if (shared->exit) return;
+			load = shared->queue[0];
+			shared->queue.removeAt(0);
+			shared->loading.add(load);
+		}
+
+		// Textures are created later by update(), on the thread owning the texture loader.
+		Atlas *atlas = new (__FILE__, __LINE__) Atlas(load->atlasPath, NULL, false);
+		SkeletonData *skeletonData = NULL;
+		String error;
+		if (atlas->getPages().size() == 0) {
+			error.append("Couldn't load atlas: ").append(load->atlasPath);
+		} else if (isBinary(load->skeletonPath)) {
+			SkeletonBinary binary(atlas);
+			binary.setScale(load->scale);
+			skeletonData = binary.readSkeletonDataFile(load->skeletonPath);
+			if (!skeletonData) error = binary.getError();
+		} else {
+			SkeletonJson json(atlas);
+			json.setScale(load->scale);
+			skeletonData = json.readSkeletonDataFile(load->skeletonPath);
+			if (!skeletonData) error = json.getError();
+		}
+		if (!skeletonData) {
+			delete atlas;
+			atlas = NULL;
+			if (error.isEmpty()) error.append("Couldn't load skeleton data: ").append(load->skeletonPath);
+		}
+
+		std::lock_guard<std::mutex> lock(shared->mutex);
+		shared->loading.removeAt(shared->loading.indexOf(load));
+		load->atlas = atlas;
+		load->skeletonData = skeletonData;
+		load->error = error;
+		if (load->cancelled)
+			dispose(load);
+		else
+			shared->finished.add(load);
+	}
+}
+
+void AsyncLoader::dispose(Load *load) {
+	delete load->skeletonData;
+	delete load->atlas;
+	delete load;
+}
+
+#endif
@@ -35,7 +35,8 @@
 
 using namespace spine;
 
-Atlas::Atlas(const String &path, TextureLoader *textureLoader, bool createTexture) : _textureLoader(textureLoader) {
+Atlas::Atlas(const String &path, TextureLoader *textureLoader, bool createTexture) : _indexedRegions(0),
+																					 _textureLoader(textureLoader) {
 	int dirLength;
 	char *dir;
 	int length;
@@ -55,15 +56,16 @@ Atlas::Atlas(const String &path, TextureLoader *textureLoader, bool createTextur
 	if (data) {
 		load(data, length, dir, createTexture);
 	}
+	indexRegions();
 
 	SpineExtension::free(data, __FILE__, __LINE__);
 	SpineExtension::free(dir, __FILE__, __LINE__);
 }
 
 Atlas::Atlas(const char *data, int length, const char *dir, TextureLoader *textureLoader, bool createTexture)
-	: _textureLoader(
-			  textureLoader) {
+	: _indexedRegions(0), _textureLoader(textureLoader) {
 	load(data, length, dir, createTexture);
+	indexRegions();
 }
 
 Atlas::~Atlas() {
@@ -76,6 +78,19 @@ Atlas::~Atlas() {
 	ContainerUtil::cleanUpVectorOfPointers(_regions);
 }
 
+void Atlas::createTextures(TextureLoader *textureLoader) {
+	_textureLoader = textureLoader;
+	if (!textureLoader) return;
+	for (size_t i = 0, n = _pages.size(); i < n; ++i) {
+		AtlasPage *page = _pages[i];
+		if (!page->texture) textureLoader->load(*page, page->texturePath);
+	}
+	for (size_t i = 0, n = _regions.size(); i < n; ++i) {
+		AtlasRegion *region = _regions[i];
+		if (!region->rendererObject) region->rendererObject = region->page->texture;
+	}
+}
+
 void Atlas::flipV() {
 	for (size_t i = 0, n = _regions.size(); i < n; ++i) {
 		AtlasRegion *regionP = _regions[i];
@@ -85,12 +100,58 @@ void Atlas::flipV() {
 	}
 }
 
+static size_t hashName(const char *name, size_t length) {
+	/* FNV-1a */
+	size_t hash = 2166136261u;
+	for (size_t i = 0; i < length; i++) {
+		hash ^= (unsigned char) name[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
 AtlasRegion *Atlas::findRegion(const String &name) {
+	if (_regionIndex.size() > 0) {
+		size_t mask = _regionIndex.size() - 1, regionCount = _regions.size();
+		for (size_t i = hashName(name.buffer(), name.length()) & mask;; i = (i + 1) & mask) {
+			int regionIndex = _regionIndex[i];
+			if (regionIndex == -1) {
+				if (regionCount == _indexedRegions) return NULL;
+				break;
+			}
+			// Regions removed since the index was built leave indices past the end.
+			if ((size_t) regionIndex >= regionCount) break;
+			if (_regions[regionIndex]->name == name) return _regions[regionIndex];
+		}
+	}
+
+	// getRegions() was changed without calling indexRegions().
 	for (size_t i = 0, n = _regions.size(); i < n; ++i)
 		if (_regions[i]->name == name) return _regions[i];
 	return NULL;
 }
 
+void Atlas::indexRegions() {
+	/* Open addressing with linear probing, kept at most half full. Regions are inserted in order, so the first region
+	 * with a given name is the first one a lookup probes. */
+	size_t capacity = 16;
+	while (capacity < _regions.size() * 2)
+		capacity <<= 1;
+	_regionIndex.setSize(capacity, -1);
+	for (size_t i = 0; i < capacity; i++)
+		_regionIndex[i] = -1;
+
+	size_t mask = capacity - 1;
+	for (size_t i = 0, n = _regions.size(); i < n; ++i) {
+		String &name = _regions[i]->name;
+		size_t slot = hashName(name.buffer(), name.length()) & mask;
+		while (_regionIndex[slot] != -1)
+			slot = (slot + 1) & mask;
+		_regionIndex[slot] = (int) i;
+	}
+	_indexedRegions = _regions.size();
+}
+
 Vector<AtlasPage *> &Atlas::getPages() {
 	return _pages;
 }
@@ -281,8 +342,8 @@ void Atlas::load(const char *begin, int length, const char *dir, bool createText
 			}
 
 			if (createTexture) {
-				if (_textureLoader) _textureLoader->load(*page, String(path));
-				SpineExtension::free(path, __FILE__, __LINE__);
+				if (_textureLoader) _textureLoader->load(*page, String(path, true));
+				else SpineExtension::free(path, __FILE__, __LINE__);
 			} else {
 				page->texturePath = String(path, true);
 			}
@@ -328,7 +389,7 @@ void Atlas::load(const char *begin, int length, const char *dir, bool createText
 				} else if (entry[0].equals("index")) {
 					region->index = entry[1].toInt();
 				} else {
-					region->names.add(String(entry[0].copy()));
+					region->names.add(String(entry[0].copy(), true));
 					for (int i = 0; i < count; i++) {
 						region->values.add(entry[i + 1].toInt());
 					}
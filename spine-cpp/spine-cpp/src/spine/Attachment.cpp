@@ -31,6 +31,10 @@
 
 #include <assert.h>
 
+#if !defined(SPINE_NO_THREADS) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 using namespace spine;
 
 RTTI_IMPL_NOPARENT(Attachment)
@@ -46,14 +50,33 @@ const String &Attachment::getName() const {
 	return _name;
 }
 
+// The count is a plain int so the header doesn't need <atomic>. Without threads it is updated like any other field.
 int Attachment::getRefCount() {
+#if defined(SPINE_NO_THREADS)
 	return _refCount;
+#elif defined(_MSC_VER)
+	return *(volatile int *) &_refCount;
+#else
+	return __atomic_load_n(&_refCount, __ATOMIC_RELAXED);
+#endif
 }
 
 void Attachment::reference() {
+#if defined(SPINE_NO_THREADS)
 	_refCount++;
+#elif defined(_MSC_VER)
+	_InterlockedIncrement((volatile long *) &_refCount);
+#else
+	__atomic_add_fetch(&_refCount, 1, __ATOMIC_RELAXED);
+#endif
 }
 
-void Attachment::dereference() {
-	_refCount--;
+int Attachment::dereference() {
+#if defined(SPINE_NO_THREADS)
+	return --_refCount;
+#elif defined(_MSC_VER)
+	return (int) _InterlockedDecrement((volatile long *) &_refCount);
+#else
+	return __atomic_sub_fetch(&_refCount, 1, __ATOMIC_ACQ_REL);
+#endif
 }
@@ -71,11 +71,19 @@ Bone::Bone(BoneData &data, Skeleton &skeleton, Bone *parent) : Updatable(),
 															   _d(1),
 															   _worldY(0),
 															   _sorted(false),
-															   _active(false) {
+															   _active(false),
+															   _dirty(true),
+															   _changed(false),
+															   _constrained(false) {
 	setToSetupPose();
 }
 
 void Bone::update() {
+	if (_skeleton._trackingChanges) {
+		if (!_dirty && !_constrained && (!_parent || !_parent->_changed)) return;
+		_dirty = false;
+		_changed = true;
+	}
 	updateWorldTransform(_ax, _ay, _arotation, _ascaleX, _ascaleY, _ashearX, _ashearY);
 }
 
@@ -98,8 +106,8 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 
 	if (!parent) { /* Root bone. */
 		float rotationY = rotation + 90 + shearY;
-		float sx = _skeleton.getScaleX();
-		float sy = _skeleton.getScaleY();
+		float sx = _skeleton.getRootScaleX();
+		float sy = _skeleton.getRootScaleY();
 		_a = MathUtil::cosDeg(rotation + shearX) * scaleX * sx;
 		_b = MathUtil::cosDeg(rotationY) * scaleY * sx;
 		_c = MathUtil::sinDeg(rotation + shearX) * scaleX * sy;
@@ -143,8 +151,8 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			float prx, rx, ry, la, lb, lc, ld;
 			if (s > 0.0001f) {
 				s = MathUtil::abs(pa * pd - pb * pc) / s;
-				pa /= _skeleton.getScaleX();
-				pc /= _skeleton.getScaleY();
+				pa /= _skeleton.getRootScaleX();
+				pc /= _skeleton.getRootScaleY();
 				pb = pc * s;
 				pd = pa * s;
 				prx = MathUtil::atan2(pc, pa) * MathUtil::Rad_Deg;
@@ -171,15 +179,15 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			float r, zb, zd, la, lb, lc, ld;
 			cosine = MathUtil::cosDeg(rotation);
 			sine = MathUtil::sinDeg(rotation);
-			za = (pa * cosine + pb * sine) / _skeleton.getScaleX();
-			zc = (pc * cosine + pd * sine) / _skeleton.getScaleY();
+			za = (pa * cosine + pb * sine) / _skeleton.getRootScaleX();
+			zc = (pc * cosine + pd * sine) / _skeleton.getRootScaleY();
 			s = MathUtil::sqrt(za * za + zc * zc);
 			if (s > 0.00001f) s = 1 / s;
 			za *= s;
 			zc *= s;
 			s = MathUtil::sqrt(za * za + zc * zc);
 			if (_data.getTransformMode() == TransformMode_NoScale &&
-				(pa * pd - pb * pc < 0) != (_skeleton.getScaleX() < 0 != _skeleton.getScaleY() < 0))
+				(pa * pd - pb * pc < 0) != (_skeleton.getRootScaleX() < 0 != _skeleton.getRootScaleY() < 0))
 				s = -s;
 			r = MathUtil::Pi / 2 + MathUtil::atan2(zc, za);
 			zb = MathUtil::cos(r) * s;
@@ -194,10 +202,10 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			_d = zc * lb + zd * ld;
 		}
 	}
-	_a *= _skeleton.getScaleX();
-	_b *= _skeleton.getScaleX();
-	_c *= _skeleton.getScaleY();
-	_d *= _skeleton.getScaleY();
+	_a *= _skeleton.getRootScaleX();
+	_b *= _skeleton.getRootScaleX();
+	_c *= _skeleton.getRootScaleY();
+	_d *= _skeleton.getRootScaleY();
 }
 
 void Bone::setToSetupPose() {
@@ -259,6 +267,7 @@ void Bone::rotateWorld(float degrees) {
 	_b = cos * b - sin * d;
 	_c = sin * a + cos * c;
 	_d = sin * b + cos * d;
+	_dirty = true;
 }
 
 float Bone::getWorldToLocalRotationX() {
@@ -371,6 +380,7 @@ float Bone::getAppliedRotation() {
 
 void Bone::setAppliedRotation(float inValue) {
 	_arotation = inValue;
+	_dirty = true;
 }
 
 float Bone::getAX() {
@@ -379,6 +389,7 @@ float Bone::getAX() {
 
 void Bone::setAX(float inValue) {
 	_ax = inValue;
+	_dirty = true;
 }
 
 float Bone::getAY() {
@@ -387,6 +398,7 @@ float Bone::getAY() {
 
 void Bone::setAY(float inValue) {
 	_ay = inValue;
+	_dirty = true;
 }
 
 float Bone::getAScaleX() {
@@ -395,6 +407,7 @@ float Bone::getAScaleX() {
 
 void Bone::setAScaleX(float inValue) {
 	_ascaleX = inValue;
+	_dirty = true;
 }
 
 float Bone::getAScaleY() {
@@ -403,6 +416,7 @@ float Bone::getAScaleY() {
 
 void Bone::setAScaleY(float inValue) {
 	_ascaleY = inValue;
+	_dirty = true;
 }
 
 float Bone::getAShearX() {
@@ -411,6 +425,7 @@ float Bone::getAShearX() {
 
 void Bone::setAShearX(float inValue) {
 	_ashearX = inValue;
+	_dirty = true;
 }
 
 float Bone::getAShearY() {
@@ -419,6 +434,7 @@ float Bone::getAShearY() {
 
 void Bone::setAShearY(float inValue) {
 	_ashearY = inValue;
+	_dirty = true;
 }
 
 float Bone::getA() {
@@ -427,6 +443,7 @@ float Bone::getA() {
 
 void Bone::setA(float inValue) {
 	_a = inValue;
+	_dirty = true;
 }
 
 float Bone::getB() {
@@ -435,6 +452,7 @@ float Bone::getB() {
 
 void Bone::setB(float inValue) {
 	_b = inValue;
+	_dirty = true;
 }
 
 float Bone::getC() {
@@ -443,6 +461,7 @@ float Bone::getC() {
 
 void Bone::setC(float inValue) {
 	_c = inValue;
+	_dirty = true;
 }
 
 float Bone::getD() {
@@ -451,6 +470,7 @@ float Bone::getD() {
 
 void Bone::setD(float inValue) {
 	_d = inValue;
+	_dirty = true;
 }
 
 float Bone::getWorldX() {
@@ -459,6 +479,7 @@ float Bone::getWorldX() {
 
 void Bone::setWorldX(float inValue) {
 	_worldX = inValue;
+	_dirty = true;
 }
 
 float Bone::getWorldY() {
@@ -467,6 +488,7 @@ float Bone::getWorldY() {
 
 void Bone::setWorldY(float inValue) {
 	_worldY = inValue;
+	_dirty = true;
 }
 
 float Bone::getWorldRotationX() {
@@ -513,10 +535,10 @@ void Bone::updateAppliedTransform() {
 		switch (_data.getTransformMode()) {
 			case TransformMode_NoRotationOrReflection: {
 				float s = MathUtil::abs(pa * pd - pb * pc) / (pa * pa + pc * pc);
-				float sa = pa / _skeleton.getScaleX();
-				float sc = pc / _skeleton.getScaleY();
-				pb = -sc * s * _skeleton.getScaleX();
-				pd = sa * s * _skeleton.getScaleY();
+				float sa = pa / _skeleton.getRootScaleX();
+				float sc = pc / _skeleton.getRootScaleY();
+				pb = -sc * s * _skeleton.getRootScaleX();
+				pd = sa * s * _skeleton.getRootScaleY();
 				pid = 1 / (pa * pd - pb * pc);
 				ia = pd * pid;
 				ib = pb * pid;
@@ -525,14 +547,14 @@ void Bone::updateAppliedTransform() {
 			case TransformMode_NoScale:
 			case TransformMode_NoScaleOrReflection: {
 				float cos = MathUtil::cosDeg(_rotation), sin = MathUtil::sinDeg(_rotation);
-				pa = (pa * cos + pb * sin) / _skeleton.getScaleX();
-				pc = (pc * cos + pd * sin) / _skeleton.getScaleY();
+				pa = (pa * cos + pb * sin) / _skeleton.getRootScaleX();
+				pc = (pc * cos + pd * sin) / _skeleton.getRootScaleY();
 				float s = MathUtil::sqrt(pa * pa + pc * pc);
 				if (s > 0.00001f) s = 1 / s;
 				pa *= s;
 				pc *= s;
 				s = MathUtil::sqrt(pa * pa + pc * pc);
-				if (_data.getTransformMode() == TransformMode_NoScale && pid < 0 != (_skeleton.getScaleX() < 0 != _skeleton.getScaleY() < 0)) s = -s;
+				if (_data.getTransformMode() == TransformMode_NoScale && pid < 0 != (_skeleton.getRootScaleX() < 0 != _skeleton.getRootScaleY() < 0)) s = -s;
 				float r = MathUtil::Pi / 2 + MathUtil::atan2(pc, pa);
 				pb = MathUtil::cos(r) * s;
 				pd = MathUtil::sin(r) * s;
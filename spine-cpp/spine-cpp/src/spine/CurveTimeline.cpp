@@ -74,6 +74,17 @@ void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float ti
 }
 
 float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueOffset, size_t i) {
+	if (_quantizedCurves.size() > 0) {
+		float points[4];
+		int sample = getQuantizedSamples(time, i, frameIndex, points);
+		if (sample == 0) {
+			float x = _frames[frameIndex], y = _frames[frameIndex + valueOffset];
+			return y + (time - x) / (points[2] - x) * (points[3] - y);
+		}
+		if (sample < BEZIER_SIZE) return points[1] + (time - points[0]) / (points[2] - points[0]) * (points[3] - points[1]);
+		frameIndex += getFrameEntries();
+		return points[1] + (time - points[0]) / (_frames[frameIndex] - points[0]) * (_frames[frameIndex + valueOffset] - points[1]);
+	}
 	if (_curves[i] > time) {
 		float x = _frames[frameIndex], y = _frames[frameIndex + valueOffset];
 		return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
@@ -90,6 +101,97 @@ float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueO
 	return y + (time - x) / (_frames[frameIndex] - x) * (_frames[frameIndex + valueOffset] - y);
 }
 
+int CurveTimeline::getQuantizedSamples(float time, size_t i, size_t frameIndex, float *points) {
+	size_t bezier = (i - _curves.size()) / BEZIER_SIZE;
+	const unsigned short *quantized = _quantizedCurves.buffer() + bezier * BEZIER_SIZE;
+	float time1 = _frames[frameIndex], duration = _frames[frameIndex + _frameEntries] - time1;
+	float timeOffset = time1 - duration, timeScale = duration * 3 / 65535;
+
+	// Only the sample times are decoded to search, then the values of the two samples around time.
+	int sample = 0;
+	if (timeOffset + quantized[0] * timeScale <= time) {
+		for (sample = 2; sample < BEZIER_SIZE; sample += 2)
+			if (timeOffset + quantized[sample] * timeScale >= time) break;
+	}
+
+	float offset = _curveRanges[bezier << 1], scale = _curveRanges[(bezier << 1) + 1];
+	if (sample > 0) {
+		points[0] = timeOffset + quantized[sample - 2] * timeScale;
+		points[1] = offset + quantized[sample - 1] * scale;
+	}
+	if (sample < BEZIER_SIZE) {
+		points[2] = timeOffset + quantized[sample] * timeScale;
+		points[3] = offset + quantized[sample + 1] * scale;
+	}
+	return sample;
+}
+
+static unsigned short quantize(float value) {
+	value = value * 65535 + 0.5f;
+	if (value <= 0) return 0;
+	if (value >= 65535) return 65535;
+	return (unsigned short) value;
+}
+
+void CurveTimeline::quantizeCurves() {
+	size_t frameCount = getFrameCount();
+	if (_quantizedCurves.size() > 0 || _curves.size() <= frameCount) return;
+	size_t bezierCount = (_curves.size() - frameCount) / BEZIER_SIZE;
+
+	// Unused beziers at the end, eg when the bezier count was not known when loading, are all zeros.
+	for (; bezierCount > 0; bezierCount--) {
+		float *curves = _curves.buffer() + frameCount + (bezierCount - 1) * BEZIER_SIZE;
+		bool used = false;
+		for (int i = 0; i < BEZIER_SIZE && !used; i++)
+			used = curves[i] != 0;
+		if (used) break;
+	}
+	if (bezierCount == 0) {
+		_curves.setSize(frameCount, 0);
+		_curves.shrink();
+		return;
+	}
+
+	// Find the frame each bezier interpolates from. A frame's curve type points to its first bezier, the beziers for
+	// its other values follow it.
+	Vector<int> bezierFrames;
+	bezierFrames.setSize(bezierCount, -1);
+	for (size_t frame = 0; frame < frameCount; frame++) {
+		int type = (int) _curves[frame];
+		if (type < BEZIER) continue;
+		size_t bezier = (type - BEZIER - frameCount) / BEZIER_SIZE;
+		if (bezier < bezierCount) bezierFrames[bezier] = (int) frame;
+	}
+
+	_quantizedCurves.ensureCapacity(bezierCount * BEZIER_SIZE);
+	_quantizedCurves.setSize(bezierCount * BEZIER_SIZE, 0);
+	_curveRanges.ensureCapacity(bezierCount << 1);
+	_curveRanges.setSize(bezierCount << 1, 0);
+	for (size_t bezier = 0, frame = 0; bezier < bezierCount; bezier++) {
+		if (bezierFrames[bezier] != -1) frame = (size_t) bezierFrames[bezier];
+		float *curves = _curves.buffer() + frameCount + bezier * BEZIER_SIZE;
+		unsigned short *quantized = _quantizedCurves.buffer() + bezier * BEZIER_SIZE;
+
+		float time1 = _frames[frame * _frameEntries], time2 = time1;
+		if (frame + 1 < frameCount) time2 = _frames[(frame + 1) * _frameEntries];
+		float min = curves[1], max = curves[1];
+		for (int i = 3; i < BEZIER_SIZE; i += 2) {
+			if (curves[i] < min) min = curves[i];
+			if (curves[i] > max) max = curves[i];
+		}
+		float scale = (max - min) / 65535;
+		_curveRanges[bezier << 1] = min;
+		_curveRanges[(bezier << 1) + 1] = scale;
+		for (int i = 0; i < BEZIER_SIZE; i += 2) {
+			quantized[i] = time2 > time1 ? quantize((curves[i] - time1 + (time2 - time1)) / ((time2 - time1) * 3)) : 0;
+			quantized[i + 1] = scale > 0 ? quantize((curves[i + 1] - min) / (max - min)) : 0;
+		}
+	}
+
+	_curves.setSize(frameCount, 0);
+	_curves.shrink();
+}
+
 Vector<float> &CurveTimeline::getCurves() {
 	return _curves;
 }
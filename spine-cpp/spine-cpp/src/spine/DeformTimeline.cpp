@@ -40,20 +40,38 @@
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
 
+#include <string.h>
+
 using namespace spine;
 
 RTTI_IMPL(DeformTimeline, CurveTimeline)
 
+// Sets the vertices from start to end to the setup pose.
+static void setupPose(float *deform, float *setupVertices, bool weighted, size_t start, size_t end) {
+	if (weighted) {
+		for (size_t i = start; i < end; i++)
+			deform[i] = 0;
+	} else {
+		for (size_t i = start; i < end; i++)
+			deform[i] = setupVertices[i];
+	}
+}
+
+// Mixes the vertices from start to end toward the setup pose.
+static void mixSetupPose(float *deform, float *setupVertices, bool weighted, size_t start, size_t end, float alpha) {
+	if (weighted) {
+		for (size_t i = start; i < end; i++)
+			deform[i] -= deform[i] * alpha;
+	} else {
+		for (size_t i = start; i < end; i++)
+			deform[i] += (setupVertices[i] - deform[i]) * alpha;
+	}
+}
+
 DeformTimeline::DeformTimeline(size_t frameCount, size_t bezierCount, int slotIndex, VertexAttachment *attachment)
-	: CurveTimeline(frameCount, 1, bezierCount), _slotIndex(slotIndex), _attachment(attachment) {
+	: CurveTimeline(frameCount, 1, bezierCount), _slotIndex(slotIndex), _start(0), _count(0), _attachment(attachment) {
 	PropertyId ids[] = {((PropertyId) Property_Deform << 32) | ((slotIndex << 16 | attachment->_id) & 0xffffffff)};
 	setPropertyIds(ids, 1);
-
-	_vertices.ensureCapacity(frameCount);
-	for (size_t i = 0; i < frameCount; ++i) {
-		Vector<float> vec;
-		_vertices.add(vec);
-	}
 }
 
 void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
@@ -81,8 +99,9 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		blend = MixBlend_Setup;
 	}
 
-	Vector<Vector<float>> &vertices = _vertices;
-	size_t vertexCount = vertices[0].size();
+	bool weighted = attachment->_bones.size() != 0;
+	Vector<float> &setupVertices = attachment->_vertices;
+	size_t vertexCount = weighted ? setupVertices.size() / 3 * 2 : setupVertices.size();
 
 	Vector<float> &frames = _frames;
 	if (time < _frames[0]) {
@@ -97,9 +116,8 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 				}
 				deformArray.setSize(vertexCount, 0);
 				Vector<float> &deform = deformArray;
-				if (attachment->getBones().size() == 0) {
+				if (!weighted) {
 					// Unweighted vertex positions.
-					Vector<float> &setupVertices = attachment->getVertices();
 					for (size_t i = 0; i < vertexCount; i++)
 						deform[i] += (setupVertices[i] - deform[i]) * alpha;
 				} else {
@@ -117,62 +135,69 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	}
 
 	deformArray.setSize(vertexCount, 0);
-	Vector<float> &deform = deformArray;
+	float *deform = deformArray.buffer();
+	float *setup = setupVertices.buffer();
+
+	// Only vertices from start to end are keyed, the rest are the setup pose in every frame. Keyed vertices are stored from
+	// start, so vertex i of a frame is at i - start.
+	size_t start = _start, end = _start + _count, count = _count;
+	if (end > vertexCount) end = vertexCount;
+	if (start > end) start = end;
 
 	if (time >= frames[frames.size() - 1]) {// Time is after last frame.
-		Vector<float> &lastVertices = vertices[frames.size() - 1];
+		float *lastVertices = _vertices.buffer() + (frames.size() - 1) * count;
 		if (alpha == 1) {
 			if (blend == MixBlend_Add) {
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
+				if (!weighted) {
 					// Unweighted vertex positions, no alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += lastVertices[i] - setupVertices[i];
+					for (size_t i = start; i < end; i++)
+						deform[i] += lastVertices[i - start] - setup[i];
 				} else {
 					// Weighted deform offsets, no alpha.
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += lastVertices[i];
+					for (size_t i = start; i < end; i++)
+						deform[i] += lastVertices[i - start];
 				}
 			} else {
 				// Vertex positions or deform offsets, no alpha.
-				memcpy(deform.buffer(), lastVertices.buffer(), vertexCount * sizeof(float));
+				setupPose(deform, setup, weighted, 0, start);
+				if (end > start) memcpy(deform + start, lastVertices, (end - start) * sizeof(float));
+				setupPose(deform, setup, weighted, end, vertexCount);
 			}
 		} else {
 			switch (blend) {
 				case MixBlend_Setup: {
-					VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-					if (vertexAttachment->getBones().size() == 0) {
+					setupPose(deform, setup, weighted, 0, start);
+					if (!weighted) {
 						// Unweighted vertex positions, with alpha.
-						Vector<float> &setupVertices = vertexAttachment->getVertices();
-						for (size_t i = 0; i < vertexCount; i++) {
-							float setup = setupVertices[i];
-							deform[i] = setup + (lastVertices[i] - setup) * alpha;
+						for (size_t i = start; i < end; i++) {
+							float setupVertex = setup[i];
+							deform[i] = setupVertex + (lastVertices[i - start] - setupVertex) * alpha;
 						}
 					} else {
 						// Weighted deform offsets, with alpha.
-						for (size_t i = 0; i < vertexCount; i++)
-							deform[i] = lastVertices[i] * alpha;
+						for (size_t i = start; i < end; i++)
+							deform[i] = lastVertices[i - start] * alpha;
 					}
+					setupPose(deform, setup, weighted, end, vertexCount);
 					break;
 				}
 				case MixBlend_First:
 				case MixBlend_Replace:
 					// Vertex positions or deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += (lastVertices[i] - deform[i]) * alpha;
+					mixSetupPose(deform, setup, weighted, 0, start, alpha);
+					for (size_t i = start; i < end; i++)
+						deform[i] += (lastVertices[i - start] - deform[i]) * alpha;
+					mixSetupPose(deform, setup, weighted, end, vertexCount, alpha);
 					break;
 				case MixBlend_Add:
-					VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-					if (vertexAttachment->getBones().size() == 0) {
+					if (!weighted) {
 						// Unweighted vertex positions, no alpha.
-						Vector<float> &setupVertices = vertexAttachment->getVertices();
-						for (size_t i = 0; i < vertexCount; i++)
-							deform[i] += (lastVertices[i] - setupVertices[i]) * alpha;
+						for (size_t i = start; i < end; i++)
+							deform[i] += (lastVertices[i - start] - setup[i]) * alpha;
 					} else {
 						// Weighted deform offsets, alpha.
-						for (size_t i = 0; i < vertexCount; i++)
-							deform[i] += lastVertices[i] * alpha;
+						for (size_t i = start; i < end; i++)
+							deform[i] += lastVertices[i - start] * alpha;
 					}
 			}
 		}
@@ -182,75 +207,75 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	// Interpolate between the previous frame and the current frame.
 	int frame = Animation::search(frames, time);
 	float percent = getCurvePercent(time, frame);
-	Vector<float> &prevVertices = vertices[frame];
-	Vector<float> &nextVertices = vertices[frame + 1];
+	float *prevVertices = _vertices.buffer() + frame * count;
+	float *nextVertices = prevVertices + count;
 
 	if (alpha == 1) {
 		if (blend == MixBlend_Add) {
-			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-			if (vertexAttachment->getBones().size() == 0) {
+			if (!weighted) {
 				// Unweighted vertex positions, no alpha.
-				Vector<float> &setupVertices = vertexAttachment->getVertices();
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += prev + (nextVertices[i] - prev) * percent - setupVertices[i];
+				for (size_t i = start; i < end; i++) {
+					float prev = prevVertices[i - start];
+					deform[i] += prev + (nextVertices[i - start] - prev) * percent - setup[i];
 				}
 			} else {
 				// Weighted deform offsets, no alpha.
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += prev + (nextVertices[i] - prev) * percent;
+				for (size_t i = start; i < end; i++) {
+					float prev = prevVertices[i - start];
+					deform[i] += prev + (nextVertices[i - start] - prev) * percent;
 				}
 			}
 		} else {
 			// Vertex positions or deform offsets, no alpha.
-			for (size_t i = 0; i < vertexCount; i++) {
-				float prev = prevVertices[i];
-				deform[i] = prev + (nextVertices[i] - prev) * percent;
+			setupPose(deform, setup, weighted, 0, start);
+			for (size_t i = start; i < end; i++) {
+				float prev = prevVertices[i - start];
+				deform[i] = prev + (nextVertices[i - start] - prev) * percent;
 			}
+			setupPose(deform, setup, weighted, end, vertexCount);
 		}
 	} else {
 		switch (blend) {
 			case MixBlend_Setup: {
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
+				setupPose(deform, setup, weighted, 0, start);
+				if (!weighted) {
 					// Unweighted vertex positions, with alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i], setup = setupVertices[i];
-						deform[i] = setup + (prev + (nextVertices[i] - prev) * percent - setup) * alpha;
+					for (size_t i = start; i < end; i++) {
+						float prev = prevVertices[i - start], setupVertex = setup[i];
+						deform[i] = setupVertex + (prev + (nextVertices[i - start] - prev) * percent - setupVertex) * alpha;
 					}
 				} else {
 					// Weighted deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i];
-						deform[i] = (prev + (nextVertices[i] - prev) * percent) * alpha;
+					for (size_t i = start; i < end; i++) {
+						float prev = prevVertices[i - start];
+						deform[i] = (prev + (nextVertices[i - start] - prev) * percent) * alpha;
 					}
 				}
+				setupPose(deform, setup, weighted, end, vertexCount);
 				break;
 			}
 			case MixBlend_First:
 			case MixBlend_Replace:
 				// Vertex positions or deform offsets, with alpha.
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += (prev + (nextVertices[i] - prev) * percent - deform[i]) * alpha;
+				mixSetupPose(deform, setup, weighted, 0, start, alpha);
+				for (size_t i = start; i < end; i++) {
+					float prev = prevVertices[i - start];
+					deform[i] += (prev + (nextVertices[i - start] - prev) * percent - deform[i]) * alpha;
 				}
+				mixSetupPose(deform, setup, weighted, end, vertexCount, alpha);
 				break;
 			case MixBlend_Add:
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
+				if (!weighted) {
 					// Unweighted vertex positions, with alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i];
-						deform[i] += (prev + (nextVertices[i] - prev) * percent - setupVertices[i]) * alpha;
+					for (size_t i = start; i < end; i++) {
+						float prev = prevVertices[i - start];
+						deform[i] += (prev + (nextVertices[i - start] - prev) * percent - setup[i]) * alpha;
 					}
 				} else {
 					// Weighted deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i];
-						deform[i] += (prev + (nextVertices[i] - prev) * percent) * alpha;
+					for (size_t i = start; i < end; i++) {
+						float prev = prevVertices[i - start];
+						deform[i] += (prev + (nextVertices[i - start] - prev) * percent) * alpha;
 					}
 				}
 		}
@@ -294,6 +319,17 @@ float DeformTimeline::getCurvePercent(float time, int frame) {
 		}
 	}
 	i -= DeformTimeline::BEZIER;
+	if (isQuantized()) {
+		float points[4];
+		int sample = getQuantizedSamples(time, i, frame, points);
+		if (sample == 0) {
+			float x = _frames[frame];
+			return points[3] * (time - x) / (points[2] - x);
+		}
+		if (sample < DeformTimeline::BEZIER_SIZE)
+			return points[1] + (time - points[0]) / (points[2] - points[0]) * (points[3] - points[1]);
+		return points[1] + (1 - points[1]) * (time - points[0]) / (_frames[frame + getFrameEntries()] - points[0]);
+	}
 	if (_curves[i] > time) {
 		float x = _frames[frame];
 		return _curves[i + 1] * (time - x) / (_curves[i] - x);
@@ -310,12 +346,55 @@ float DeformTimeline::getCurvePercent(float time, int frame) {
 }
 
 void DeformTimeline::setFrame(int frame, float time, Vector<float> &vertices) {
+	// Trim the vertices at either end that are the setup pose.
+	size_t start = 0, end = vertices.size();
+	while (start < end && vertices[start] == getSetupVertex(start))
+		start++;
+	while (end > start && vertices[end - 1] == getSetupVertex(end - 1))
+		end--;
+	setFrame(frame, time, start, vertices.buffer() + start, end - start);
+}
+
+void DeformTimeline::setFrame(int frame, float time, size_t start, const float *vertices, size_t count) {
 	_frames[frame] = time;
-	_vertices[frame].clear();
-	_vertices[frame].addAll(vertices);
+	ensureRange(start, start + count);
+	float *frameVertices = _vertices.buffer() + frame * _count;
+	for (size_t i = _start, n = _start + _count; i < n; i++)
+		frameVertices[i - _start] = getSetupVertex(i);
+	if (count > 0) memcpy(frameVertices + start - _start, vertices, count * sizeof(float));
+}
+
+void DeformTimeline::ensureRange(size_t start, size_t end) {
+	if (start >= end) return;
+	size_t oldStart = _start, oldCount = _count;
+	if (oldCount > 0) {
+		if (start >= oldStart && end <= oldStart + oldCount) return;
+		if (start > oldStart) start = oldStart;
+		if (end < oldStart + oldCount) end = oldStart + oldCount;
+	}
+
+	Vector<float> oldVertices(std::move(_vertices));
+	_start = start;
+	_count = end - start;
+	size_t frameCount = getFrameCount();
+	_vertices.ensureCapacity(frameCount * _count);
+	_vertices.setSize(frameCount * _count, 0);
+	for (size_t frame = 0; frame < frameCount; frame++) {
+		float *frameVertices = _vertices.buffer() + frame * _count;
+		for (size_t i = 0; i < _count; i++)
+			frameVertices[i] = getSetupVertex(start + i);
+		if (oldCount > 0)
+			memcpy(frameVertices + oldStart - start, oldVertices.buffer() + frame * oldCount, oldCount * sizeof(float));
+	}
+}
+
+float DeformTimeline::getSetupVertex(size_t index) {
+	if (_attachment->_bones.size() != 0) return 0;
+	Vector<float> &vertices = _attachment->_vertices;
+	return index < vertices.size() ? vertices[index] : 0;
 }
 
-Vector<Vector<float>> &DeformTimeline::getVertices() {
+Vector<float> &DeformTimeline::getVertices() {
 	return _vertices;
 }
 
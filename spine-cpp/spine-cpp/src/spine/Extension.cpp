@@ -36,6 +36,14 @@ using namespace spine;
 
 SpineExtension *SpineExtension::_instance = NULL;
 
+// Not a static member, thread local data can't be exported from a DLL. Without threads there is only one thread to
+// set it for.
+#ifndef SPINE_NO_THREADS
+static thread_local SpineExtension *threadInstance = NULL;
+#else
+static SpineExtension *threadInstance = NULL;
+#endif
+
 void SpineExtension::setInstance(SpineExtension *inValue) {
 	assert(inValue);
 
@@ -43,12 +51,21 @@ void SpineExtension::setInstance(SpineExtension *inValue) {
 }
 
 SpineExtension *SpineExtension::getInstance() {
+	if (threadInstance) return threadInstance;
 	if (!_instance) _instance = spine::getDefaultExtension();
 	assert(_instance);
 
 	return _instance;
 }
 
+void SpineExtension::setThreadInstance(SpineExtension *extension) {
+	threadInstance = extension;
+}
+
+SpineExtension *SpineExtension::getThreadInstance() {
+	return threadInstance;
+}
+
 SpineExtension::~SpineExtension() {
 }
 
@@ -52,10 +52,10 @@ void IkConstraint::apply(Bone &bone, float targetX, float targetY, bool compress
 			break;
 		case TransformMode_NoRotationOrReflection: {
 			float s = MathUtil::abs(pa * pd - pb * pc) / MathUtil::max(0.0001f, pa * pa + pc * pc);
-			float sa = pa / bone._skeleton.getScaleX();
-			float sc = pc / bone._skeleton.getScaleY();
-			pb = -sc * s * bone._skeleton.getScaleX();
-			pd = sa * s * bone._skeleton.getScaleY();
+			float sa = pa / bone._skeleton.getRootScaleX();
+			float sc = pc / bone._skeleton.getRootScaleY();
+			pb = -sc * s * bone._skeleton.getRootScaleX();
+			pd = sa * s * bone._skeleton.getRootScaleY();
 			rotationIK += MathUtil::atan2(sc, sa) * MathUtil::Rad_Deg;
 		}
 		default:
@@ -53,6 +53,11 @@ const int Json::JSON_OBJECT = 6;
 
 const char *Json::_error = NULL;
 
+struct Json::Arena {
+	Json *items;
+	Json **children;
+};
+
 Json *Json::getItem(Json *object, const char *string) {
 	Json *c = object->_child;
 	while (c && json_strcasecmp(c->_name, string)) {
@@ -62,12 +67,17 @@ Json *Json::getItem(Json *object, const char *string) {
 }
 
 Json *Json::getItem(Json *object, int childIndex) {
-	Json *current = object->_child;
-	while (current != NULL && childIndex > 0) {
-		childIndex--;
-		current = current->_next;
+	if (childIndex < 0 || childIndex >= object->_size) {
+		return NULL;
+	}
+	if (object->_children) return object->_children[childIndex];
+
+	/* Parsing failed before the children were indexed, so _size counts the children parsed so far. */
+	Json *c = object->_child;
+	while (c && childIndex--) {
+		c = c->_next;
 	}
-	return current;
+	return c;
 }
 
 const char *Json::getString(Json *object, const char *name, const char *defaultValue) {
@@ -117,35 +127,69 @@ Json::Json(const char *value) : _next(NULL),
 								_valueString(NULL),
 								_valueInt(0),
 								_valueFloat(0),
-								_name(NULL) {
+								_name(NULL),
+								_children(NULL),
+								_arena(NULL) {
 	if (value) {
-		value = parseValue(this, skip(value));
+		parse(value, strlen(value));
+	}
+}
 
-		assert(value);
+Json::Json(const char *value, size_t length) : _next(NULL),
+#if SPINE_JSON_HAVE_PREV
+											   _prev(NULL),
+#endif
+											   _child(NULL),
+											   _type(0),
+											   _size(0),
+											   _valueString(NULL),
+											   _valueInt(0),
+											   _valueFloat(0),
+											   _name(NULL),
+											   _children(NULL),
+											   _arena(NULL) {
+	if (value) {
+		parse(value, length);
 	}
 }
 
 Json::~Json() {
-	spine::Json *curr = NULL;
-	spine::Json *next = _child;
-	do {
-		curr = next;
-		if (curr) {
-			next = curr->_next;
-		}
-		delete curr;
-	} while (next);
-
-	if (_valueString) {
-		SpineExtension::free(_valueString, __FILE__, __LINE__);
+	/* Items in the arena own nothing, so only the root has anything to free. */
+	if (_arena) {
+		SpineExtension::free(_arena, __FILE__, __LINE__);
 	}
+}
 
-	if (_name) {
-		SpineExtension::free(_name, __FILE__, __LINE__);
+void Json::parse(const char *value, size_t length) {
+	/* Every item but the root is either the first child of an array or object or follows a comma, which bounds
+	 * the number of items (and child index entries) the arena must hold. */
+	size_t numItems = 0;
+	for (size_t i = 0; i < length; i++) {
+		char c = value[i];
+		if (c == ',' || c == '[' || c == '{') {
+			numItems++;
+		}
 	}
+
+	size_t itemsSize = sizeof(Json) * numItems;
+	size_t childrenSize = sizeof(Json *) * numItems;
+	char *block = SpineExtension::alloc<char>(itemsSize + childrenSize + length + 1, __FILE__, __LINE__);
+	_arena = block;
+
+	/* Strings are unescaped in place in a copy of the text, which lives at the end of the arena. */
+	char *text = block + itemsSize + childrenSize;
+	memcpy(text, value, length);
+	text[length] = 0;
+
+	Arena arena;
+	arena.items = (Json *) block;
+	arena.children = (Json **) (block + itemsSize);
+	/* On malformed input getError() points at the error and the items parsed so far stay reachable. */
+	_error = NULL;
+	parseValue(arena, this, skip(text));
 }
 
-const char *Json::skip(const char *inValue) {
+char *Json::skip(char *inValue) {
 	if (!inValue) {
 		/* must propagate NULL since it's often called in skip(f(...)) form */
 		return NULL;
@@ -158,7 +202,7 @@ const char *Json::skip(const char *inValue) {
 	return inValue;
 }
 
-const char *Json::parseValue(Json *item, const char *value) {
+char *Json::parseValue(Arena &arena, Json *item, char *value) {
 	/* Referenced by constructor, parseArray(), and parseObject(). */
 	/* Always called with the result of skip(). */
 #ifdef SPINE_JSON_DEBUG /* Checked at entry to graph, constructor, and after every parse call. */
@@ -195,9 +239,9 @@ const char *Json::parseValue(Json *item, const char *value) {
 		case '\"':
 			return parseString(item, value);
 		case '[':
-			return parseArray(item, value);
+			return parseArray(arena, item, value);
 		case '{':
-			return parseObject(item, value);
+			return parseObject(arena, item, value);
 		case '-': /* fallthrough */
 		case '0': /* fallthrough */
 		case '1': /* fallthrough */
@@ -220,8 +264,8 @@ const char *Json::parseValue(Json *item, const char *value) {
 
 static const unsigned char firstByteMark[7] = {0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC};
 
-const char *Json::parseString(Json *item, const char *str) {
-	const char *ptr = str + 1;
+char *Json::parseString(Json *item, char *str) {
+	char *ptr = str + 1;
 	char *ptr2;
 	char *out;
 	int len = 0;
@@ -232,18 +276,8 @@ const char *Json::parseString(Json *item, const char *str) {
 		return 0;
 	} /* not a string! */
 
-	while (*ptr != '\"' && *ptr && ++len) {
-		if (*ptr++ == '\\') {
-			ptr++; /* Skip escaped quotes. */
-		}
-	}
-
-	out = SpineExtension::alloc<char>(len + 1, __FILE__, __LINE__); /* The length needed for the string, roughly. */
-	if (!out) {
-		return 0;
-	}
-
-	ptr = str + 1;
+	/* An unescaped string is never longer than its escaped form, so it is written over the input. */
+	out = str + 1;
 	ptr2 = out;
 	while (*ptr != '\"' && *ptr) {
 		if (*ptr != '\\') {
@@ -325,22 +359,22 @@ const char *Json::parseString(Json *item, const char *str) {
 		}
 	}
 
-	*ptr2 = 0;
-
 	if (*ptr == '\"') {
 		ptr++; /* TODO error handling if not \" or \0 ? */
 	}
 
+	*ptr2 = 0;
+
 	item->_valueString = out;
 	item->_type = JSON_STRING;
 
 	return ptr;
 }
 
-const char *Json::parseNumber(Json *item, const char *num) {
+char *Json::parseNumber(Json *item, char *num) {
 	double result = 0.0;
 	int negative = 0;
-	char *ptr = (char *) num;
+	char *ptr = num;
 
 	if (*ptr == '-') {
 		negative = -1;
@@ -408,7 +442,7 @@ const char *Json::parseNumber(Json *item, const char *num) {
 	}
 }
 
-const char *Json::parseArray(Json *item, const char *value) {
+char *Json::parseArray(Arena &arena, Json *item, char *value) {
 	Json *child;
 
 #ifdef SPINE_JSON_DEBUG /* unnecessary, only callsite (parse_value) verifies this */
@@ -424,12 +458,9 @@ const char *Json::parseArray(Json *item, const char *value) {
 		return value + 1; /* empty array. */
 	}
 
-	item->_child = child = new (__FILE__, __LINE__) Json(NULL);
-	if (!item->_child) {
-		return NULL; /* memory fail */
-	}
+	item->_child = child = new (arena.items++) Json(NULL);
 
-	value = skip(parseValue(child, skip(value))); /* skip any spacing, get the value. */
+	value = skip(parseValue(arena, child, skip(value))); /* skip any spacing, get the value. */
 
 	if (!value) {
 		return NULL;
@@ -438,16 +469,13 @@ const char *Json::parseArray(Json *item, const char *value) {
 	item->_size = 1;
 
 	while (*value == ',') {
-		Json *new_item = new (__FILE__, __LINE__) Json(NULL);
-		if (!new_item) {
-			return NULL; /* memory fail */
-		}
+		Json *new_item = new (arena.items++) Json(NULL);
 		child->_next = new_item;
 #if SPINE_JSON_HAVE_PREV
 		new_item->prev = child;
 #endif
 		child = new_item;
-		value = skip(parseValue(child, skip(value + 1)));
+		value = skip(parseValue(arena, child, skip(value + 1)));
 		if (!value) {
 			return NULL; /* parse fail */
 		}
@@ -455,6 +483,7 @@ const char *Json::parseArray(Json *item, const char *value) {
 	}
 
 	if (*value == ']') {
+		indexChildren(arena, item);
 		return value + 1; /* end of array */
 	}
 
@@ -464,7 +493,7 @@ const char *Json::parseArray(Json *item, const char *value) {
 }
 
 /* Build an object from the text. */
-const char *Json::parseObject(Json *item, const char *value) {
+char *Json::parseObject(Arena &arena, Json *item, char *value) {
 	Json *child;
 
 #ifdef SPINE_JSON_DEBUG /* unnecessary, only callsite (parse_value) verifies this */
@@ -480,10 +509,7 @@ const char *Json::parseObject(Json *item, const char *value) {
 		return value + 1; /* empty array. */
 	}
 
-	item->_child = child = new (__FILE__, __LINE__) Json(NULL);
-	if (!item->_child) {
-		return NULL;
-	}
+	item->_child = child = new (arena.items++) Json(NULL);
 	value = skip(parseString(child, skip(value)));
 	if (!value) {
 		return NULL;
@@ -495,7 +521,7 @@ const char *Json::parseObject(Json *item, const char *value) {
 		return NULL;
 	} /* fail! */
 
-	value = skip(parseValue(child, skip(value + 1))); /* skip any spacing, get the value. */
+	value = skip(parseValue(arena, child, skip(value + 1))); /* skip any spacing, get the value. */
 	if (!value) {
 		return NULL;
 	}
@@ -503,10 +529,7 @@ const char *Json::parseObject(Json *item, const char *value) {
 	item->_size = 1;
 
 	while (*value == ',') {
-		Json *new_item = new (__FILE__, __LINE__) Json(NULL);
-		if (!new_item) {
-			return NULL; /* memory fail */
-		}
+		Json *new_item = new (arena.items++) Json(NULL);
 		child->_next = new_item;
 #if SPINE_JSON_HAVE_PREV
 		new_item->prev = child;
@@ -523,7 +546,7 @@ const char *Json::parseObject(Json *item, const char *value) {
 			return NULL;
 		} /* fail! */
 
-		value = skip(parseValue(child, skip(value + 1))); /* skip any spacing, get the value. */
+		value = skip(parseValue(arena, child, skip(value + 1))); /* skip any spacing, get the value. */
 		if (!value) {
 			return NULL;
 		}
@@ -531,7 +554,8 @@ const char *Json::parseObject(Json *item, const char *value) {
 	}
 
 	if (*value == '}') {
-		return value + 1; /* end of array */
+		indexChildren(arena, item);
+		return value + 1; /* end of object */
 	}
 
 	_error = value;
@@ -539,6 +563,15 @@ const char *Json::parseObject(Json *item, const char *value) {
 	return NULL; /* malformed. */
 }
 
+void Json::indexChildren(Arena &arena, Json *item) {
+	Json **children = arena.children;
+	item->_children = children;
+	arena.children += item->_size;
+	for (Json *child = item->_child; child; child = child->_next) {
+		*children++ = child;
+	}
+}
+
 int Json::json_strcasecmp(const char *s1, const char *s2) {
 	/* TODO we may be able to elide these NULL checks if we can prove
 	 * the graph and input (only callsite is Json_getItem) should not have NULLs
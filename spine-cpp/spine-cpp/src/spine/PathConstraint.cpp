@@ -131,13 +131,14 @@ void PathConstraint::update() {
 		}
 		default: {
 			bool lengthSpacing = data._spacingMode == SpacingMode_Length;
+			float dataScale = _target->getSkeleton().getDataScale();
 			for (size_t i = 0, n = spacesCount - 1; i < n;) {
 				Bone *boneP = _bones[i];
 				Bone &bone = *boneP;
 				float setupLength = bone._data.getLength();
 				if (setupLength < PathConstraint::EPSILON) {
 					if (scale) _lengths[i] = 0;
-					_spaces[++i] = spacing;
+					_spaces[++i] = spacing * dataScale;
 				} else {
 					float x = setupLength * bone._a, y = setupLength * bone._c;
 					float length = MathUtil::sqrt(x * x + y * y);
@@ -299,6 +300,9 @@ PathConstraint::computeWorldPositions(PathAttachment &path, int spacesCount, boo
 		pathLength = lengths[curveCount];
 		if (_data._positionMode == PositionMode_Percent) position *= pathLength;
 
+		// The lengths are in the skeleton data's units, so fixed and length spaces are converted from world units and
+		// distances beyond the ends of the path are converted back.
+		float dataScale = target.getSkeleton().getDataScale();
 		float multiplier = 0;
 		switch (_data._spacingMode) {
 			case SpacingMode_Percent:
@@ -308,7 +312,7 @@ PathConstraint::computeWorldPositions(PathAttachment &path, int spacesCount, boo
 				multiplier = pathLength / spacesCount;
 				break;
 			default:
-				multiplier = 1;
+				multiplier = 1 / dataScale;
 		}
 
 		world.setSize(8, 0);
@@ -327,7 +331,7 @@ PathConstraint::computeWorldPositions(PathAttachment &path, int spacesCount, boo
 					path.computeWorldVertices(target, 2, 4, world, 0);
 				}
 
-				addBeforePosition(p, world, 0, out, o);
+				addBeforePosition(p * dataScale, world, 0, out, o);
 
 				continue;
 			} else if (p > pathLength) {
@@ -336,7 +340,7 @@ PathConstraint::computeWorldPositions(PathAttachment &path, int spacesCount, boo
 					path.computeWorldVertices(target, verticesLength - 6, 4, world, 0);
 				}
 
-				addAfterPosition(p - pathLength, world, 0, out, o);
+				addAfterPosition((p - pathLength) * dataScale, world, 0, out, o);
 
 				continue;
 			}
@@ -422,7 +426,10 @@ PathConstraint::computeWorldPositions(PathAttachment &path, int spacesCount, boo
 		y1 = y2;
 	}
 
-	if (_data._positionMode == PositionMode_Percent) position *= pathLength;
+	if (_data._positionMode == PositionMode_Percent)
+		position *= pathLength;
+	else
+		position *= target.getSkeleton().getDataScale();
 
 	float multiplier = 0;
 	switch (_data._spacingMode) {
@@ -0,0 +1,346 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/ProfilerExtension.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+using namespace spine;
+
+namespace {
+	const char *unknownFile = "<unknown>";
+
+	size_t hashPointer(const void *pointer) {
+		size_t hash = (size_t) pointer >> 3;
+		hash ^= hash >> 17;
+		hash *= 0xed5ad4bbu;
+		return hash ^ (hash >> 11);
+	}
+
+	size_t hashSite(const char *file, int line) {
+		return hashPointer(file) ^ ((size_t) line * 2654435761u);
+	}
+
+	int compareBytes(const void *a, const void *b) {
+		size_t bytesA = (*(const ProfilerExtension::Site **) a)->bytes;
+		size_t bytesB = (*(const ProfilerExtension::Site **) b)->bytes;
+		return bytesA < bytesB ? 1 : (bytesA > bytesB ? -1 : 0);
+	}
+
+	void printEscaped(FILE *file, const char *chars) {
+		for (; *chars; chars++) {
+			if (*chars == '"' || *chars == '\\') fputc('\\', file);
+			fputc(*chars, file);
+		}
+	}
+}
+
+ProfilerExtension::ProfilerExtension(SpineExtension *extension) : _extension(extension), _sites(NULL), _siteCount(0),
+																	_siteCapacity(0), _siteKeys(NULL), _siteKeyCount(0),
+																	_siteKeyCapacity(0), _live(NULL), _liveCount(0),
+																	_liveCapacity(0) {
+	clear();
+}
+
+ProfilerExtension::~ProfilerExtension() {
+	::free(_sites);
+	::free(_siteKeys);
+	::free(_live);
+}
+
+void ProfilerExtension::endFrame() {
+	int bucket = 0;
+	for (size_t n = _frameAllocations; n > 0 && bucket < FrameBuckets - 1; n >>= 1)
+		bucket++;
+	_frameHistogram[bucket]++;
+	_frame++;
+	_frameAllocations = 0;
+}
+
+void ProfilerExtension::reset() {
+	for (size_t i = 0; i < _siteCount; i++) {
+		Site &site = _sites[i];
+		site.allocations = 0;
+		site.reallocations = 0;
+		site.frees = 0;
+		site.bytes = 0;
+		site.peakLiveBytes = site.liveBytes;
+		site.frames = 0;
+		site.lastFrame = (size_t) -1;
+	}
+	_allocations = 0;
+	_reallocations = 0;
+	_frees = 0;
+	_untrackedFrees = 0;
+	_peakLiveBytes = _liveBytes;
+	_frame = 0;
+	_frameAllocations = 0;
+	memset(_frameHistogram, 0, sizeof(_frameHistogram));
+}
+
+void ProfilerExtension::clear() {
+	if (_live) memset(_live, 0, sizeof(Live) * _liveCapacity);
+	_liveCount = 0;
+	_liveBytes = 0;
+	for (size_t i = 0; i < _siteCount; i++)
+		_sites[i].liveBytes = 0;
+	reset();
+}
+
+void ProfilerExtension::dump(FILE *file) {
+	fprintf(file,
+			"{\n\t\"allocations\": %zu,\n\t\"reallocations\": %zu,\n\t\"frees\": %zu,\n\t\"untrackedFrees\": %zu,\n"
+			"\t\"liveCount\": %zu,\n\t\"liveBytes\": %zu,\n\t\"peakLiveBytes\": %zu,\n\t\"frames\": %zu,\n"
+			"\t\"frameHistogram\": [",
+			_allocations, _reallocations, _frees, _untrackedFrees, _liveCount, _liveBytes, _peakLiveBytes, _frame);
+	for (int i = 0; i < FrameBuckets; i++)
+		fprintf(file, i > 0 ? ", %zu" : "%zu", _frameHistogram[i]);
+	fprintf(file, "],\n\t\"sites\": [");
+
+	const Site **sorted = (const Site **) ::malloc(sizeof(Site *) * (_siteCount > 0 ? _siteCount : 1));
+	for (size_t i = 0; i < _siteCount; i++)
+		sorted[i] = &_sites[i];
+	qsort(sorted, _siteCount, sizeof(Site *), compareBytes);
+	for (size_t i = 0; i < _siteCount; i++) {
+		const Site &site = *sorted[i];
+		fprintf(file, i > 0 ? ",\n\t\t{\"file\": \"" : "\n\t\t{\"file\": \"");
+		printEscaped(file, site.file);
+		fprintf(file,
+				"\", \"line\": %d, \"allocations\": %zu, \"reallocations\": %zu, \"frees\": %zu, \"bytes\": %zu, "
+				"\"liveBytes\": %zu, \"peakLiveBytes\": %zu, \"frames\": %zu}",
+				site.line, site.allocations, site.reallocations, site.frees, site.bytes, site.liveBytes,
+				site.peakLiveBytes, site.frames);
+	}
+	::free(sorted);
+	fprintf(file, _siteCount > 0 ? "\n\t]\n}\n" : "]\n}\n");
+}
+
+bool ProfilerExtension::isLive(void *mem) {
+	if (!mem || _liveCount == 0) return false;
+	size_t mask = _liveCapacity - 1;
+	for (size_t i = hashPointer(mem) & mask; _live[i].address; i = (i + 1) & mask)
+		if (_live[i].address == mem) return true;
+	return false;
+}
+
+void ProfilerExtension::forEachLive(void (*callback)(void *, size_t, const Site &, void *), void *userData) {
+	for (size_t i = 0; i < _liveCapacity; i++) {
+		Live &live = _live[i];
+		if (live.address) callback(live.address, live.size, _sites[live.site], userData);
+	}
+}
+
+void *ProfilerExtension::_alloc(size_t size, const char *file, int line) {
+	void *result = _extension->_alloc(size, file, line);
+	if (result) {
+		int site = findSite(file, line);
+		record(site, size, false);
+		track(result, size, site);
+	}
+	return result;
+}
+
+void *ProfilerExtension::_calloc(size_t size, const char *file, int line) {
+	void *result = _extension->_calloc(size, file, line);
+	if (result) {
+		int site = findSite(file, line);
+		record(site, size, false);
+		track(result, size, site);
+	}
+	return result;
+}
+
+void *ProfilerExtension::_realloc(void *ptr, size_t size, const char *file, int line) {
+	if (ptr) untrack(ptr);
+	void *result = _extension->_realloc(ptr, size, file, line);
+	if (result) {
+		// The memory is attributed to the site that last resized it.
+		int site = findSite(file, line);
+		record(site, size, ptr != NULL);
+		track(result, size, site);
+	}
+	return result;
+}
+
+void ProfilerExtension::_free(void *mem, const char *file, int line) {
+	if (mem) {
+		int site = untrack(mem);
+		if (site != -1) {
+			_sites[site].frees++;
+			_frees++;
+		} else
+			_untrackedFrees++;
+	}
+	_extension->_free(mem, file, line);
+}
+
+char *ProfilerExtension::_readFile(const String &path, int *length) {
+	return _extension->_readFile(path, length);
+}
+
+void ProfilerExtension::_beforeFree(void *ptr) {
+	_extension->_beforeFree(ptr);
+}
+
+int ProfilerExtension::findSite(const char *file, int line) {
+	if (!file) file = unknownFile;
+	if (_siteKeyCapacity > 0) {
+		size_t mask = _siteKeyCapacity - 1;
+		for (size_t i = hashSite(file, line) & mask; _siteKeys[i].file; i = (i + 1) & mask) {
+			SiteKey &key = _siteKeys[i];
+			if (key.file == file && key.line == line) return key.site;
+		}
+	}
+
+	// A header may have a different file pointer in each translation unit, so look for the site by name before adding it.
+	int site = -1;
+	for (size_t i = 0; i < _siteCount; i++) {
+		if (_sites[i].line == line && strcmp(_sites[i].file, file) == 0) {
+			site = (int) i;
+			break;
+		}
+	}
+	if (site == -1) {
+		if (_siteCount == _siteCapacity) {
+			_siteCapacity = _siteCapacity > 0 ? _siteCapacity << 1 : 64;
+			_sites = (Site *) ::realloc(_sites, sizeof(Site) * _siteCapacity);
+		}
+		site = (int) _siteCount++;
+		Site &newSite = _sites[site];
+		memset(&newSite, 0, sizeof(Site));
+		newSite.file = file;
+		newSite.line = line;
+		newSite.lastFrame = (size_t) -1;
+	}
+
+	if ((_siteKeyCount + 1) * 2 > _siteKeyCapacity) growSiteKeys();
+	size_t mask = _siteKeyCapacity - 1;
+	size_t i = hashSite(file, line) & mask;
+	while (_siteKeys[i].file)
+		i = (i + 1) & mask;
+	_siteKeys[i].file = file;
+	_siteKeys[i].line = line;
+	_siteKeys[i].site = site;
+	_siteKeyCount++;
+	return site;
+}
+
+void ProfilerExtension::record(int siteIndex, size_t size, bool reallocation) {
+	Site &site = _sites[siteIndex];
+	if (reallocation) {
+		site.reallocations++;
+		_reallocations++;
+	} else {
+		site.allocations++;
+		_allocations++;
+	}
+	site.bytes += size;
+	site.liveBytes += size;
+	if (site.liveBytes > site.peakLiveBytes) site.peakLiveBytes = site.liveBytes;
+	if (site.lastFrame != _frame) {
+		site.lastFrame = _frame;
+		site.frames++;
+	}
+	_liveBytes += size;
+	if (_liveBytes > _peakLiveBytes) _peakLiveBytes = _liveBytes;
+	_frameAllocations++;
+}
+
+void ProfilerExtension::track(void *address, size_t size, int site) {
+	if ((_liveCount + 1) * 2 > _liveCapacity) growLive();
+	size_t mask = _liveCapacity - 1;
+	size_t i = hashPointer(address) & mask;
+	while (_live[i].address)
+		i = (i + 1) & mask;
+	_live[i].address = address;
+	_live[i].size = size;
+	_live[i].site = site;
+	_liveCount++;
+}
+
+int ProfilerExtension::untrack(void *address) {
+	if (_liveCount == 0) return -1;
+	size_t mask = _liveCapacity - 1;
+	size_t i = hashPointer(address) & mask;
+	while (_live[i].address != address) {
+		if (!_live[i].address) return -1;
+		i = (i + 1) & mask;
+	}
+	int site = _live[i].site;
+	_sites[site].liveBytes -= _live[i].size;
+	_liveBytes -= _live[i].size;
+	_liveCount--;
+
+	// Shift back following entries that can't be found past the emptied slot anymore.
+	for (size_t j = (i + 1) & mask; _live[j].address; j = (j + 1) & mask) {
+		size_t home = hashPointer(_live[j].address) & mask;
+		if (((j - home) & mask) >= ((j - i) & mask)) {
+			_live[i] = _live[j];
+			i = j;
+		}
+	}
+	_live[i].address = NULL;
+	return site;
+}
+
+void ProfilerExtension::growSiteKeys() {
+	SiteKey *oldKeys = _siteKeys;
+	size_t oldCapacity = _siteKeyCapacity;
+	_siteKeyCapacity = oldCapacity > 0 ? oldCapacity << 1 : 256;
+	_siteKeys = (SiteKey *) ::calloc(_siteKeyCapacity, sizeof(SiteKey));
+	size_t mask = _siteKeyCapacity - 1;
+	for (size_t i = 0; i < oldCapacity; i++) {
+		SiteKey &key = oldKeys[i];
+		if (!key.file) continue;
+		size_t j = hashSite(key.file, key.line) & mask;
+		while (_siteKeys[j].file)
+			j = (j + 1) & mask;
+		_siteKeys[j] = key;
+	}
+	::free(oldKeys);
+}
+
+void ProfilerExtension::growLive() {
+	Live *oldLive = _live;
+	size_t oldCapacity = _liveCapacity;
+	_liveCapacity = oldCapacity > 0 ? oldCapacity << 1 : 1024;
+	_live = (Live *) ::calloc(_liveCapacity, sizeof(Live));
+	size_t mask = _liveCapacity - 1;
+	for (size_t i = 0; i < oldCapacity; i++) {
+		Live &live = oldLive[i];
+		if (!live.address) continue;
+		size_t j = hashPointer(live.address) & mask;
+		while (_live[j].address)
+			j = (j + 1) & mask;
+		_live[j] = live;
+	}
+	::free(oldLive);
+}
@@ -29,6 +29,9 @@
 
 #include <spine/Skeleton.h>
 
+#include <spine/Animation.h>
+#include <spine/AnimationBounds.h>
+#include <spine/AnimationState.h>
 #include <spine/Attachment.h>
 #include <spine/Bone.h>
 #include <spine/IkConstraint.h>
@@ -50,16 +53,89 @@
 #include <spine/ContainerUtil.h>
 
 #include <float.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef SPINE_NO_THREADS
+#include <atomic>
+#endif
 
 using namespace spine;
 
+struct Skeleton::SkinUpdateCache : public SpineObject {
+	Vector<int> bones;
+	Vector<ConstraintData *> constraints;
+	Vector<int> pathBones;
+	Vector<Updatable *> updateCache;
+	Vector<bool> active;
+};
+
+// Skeletons usually switch between a few skins, so a short most recently used list is enough.
+static const size_t maxSkinUpdateCaches = 8;
+
+static int compareBoneIndices(const void *a, const void *b) {
+	int indexA = *(const int *) a, indexB = *(const int *) b;
+	return indexA < indexB ? -1 : (indexA > indexB ? 1 : 0);
+}
+
+static int compareConstraints(const void *a, const void *b) {
+	size_t addressA = (size_t) *(ConstraintData *const *) a, addressB = (size_t) *(ConstraintData *const *) b;
+	return addressA < addressB ? -1 : (addressA > addressB ? 1 : 0);
+}
+
+// Appends the bones a path attachment makes sortPathConstraintAttachment() sort, in the same order.
+static void addPathBones(Vector<int> &key, Attachment *attachment, int slotBoneIndex) {
+	if (attachment == NULL || !attachment->getRTTI().instanceOf(PathAttachment::rtti)) return;
+	Vector<int> &pathBones = static_cast<PathAttachment *>(attachment)->getBones();
+	if (pathBones.size() == 0) {
+		key.add(slotBoneIndex);
+		return;
+	}
+	for (size_t i = 0, n = pathBones.size(); i < n;) {
+		size_t nn = pathBones[i++];
+		nn += i;
+		while (i < nn)
+			key.add(pathBones[i++]);
+	}
+}
+
+static size_t getNextID() {
+	// Skeletons may be created on several threads. IDs start at 1, so 0 can mean no skeleton.
+#ifndef SPINE_NO_THREADS
+	static std::atomic<size_t> nextID(1);
+#else
+	static size_t nextID = 1;
+#endif
+	return nextID++;
+}
+
+template<typename T>
+static bool sameItems(Vector<T> &a, Vector<T> &b) {
+	if (a.size() != b.size()) return false;
+	return a.size() == 0 || memcmp(a.buffer(), b.buffer(), sizeof(T) * a.size()) == 0;
+}
+
 Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
 												 _skin(NULL),
 												 _color(1, 1, 1, 1),
 												 _scaleX(1),
 												 _scaleY(1),
+												 _dataScale(1),
 												 _x(0),
-												 _y(0) {
+												 _y(0),
+												 _changeTracking(false),
+												 _trackingChanges(false),
+												 _updateAll(true),
+												 _updatedX(0),
+												 _updatedY(0),
+												 _updatedScaleX(0),
+												 _updatedScaleY(0),
+												 _id(getNextID()),
+												 _generation(0),
+#ifndef SPINE_NO_THREADS
+												 _updatePool(NULL),
+#endif
+												 _updateStagesDirty(true) {
 	_bones.ensureCapacity(_data->getBones().size());
 	for (size_t i = 0; i < _data->getBones().size(); ++i) {
 		BoneData *data = _data->getBones()[i];
@@ -119,6 +195,7 @@ Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
 }
 
 Skeleton::~Skeleton() {
+	ContainerUtil::cleanUpVectorOfPointers(_skinUpdateCaches);
 	ContainerUtil::cleanUpVectorOfPointers(_bones);
 	ContainerUtil::cleanUpVectorOfPointers(_slots);
 	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
@@ -127,6 +204,101 @@ Skeleton::~Skeleton() {
 }
 
 void Skeleton::updateCache() {
+	ContainerUtil::cleanUpVectorOfPointers(_skinUpdateCaches);
+	updateSkinCache();
+}
+
+void Skeleton::updateSkinCache() {
+	_updateAll = true;
+	_updateStagesDirty = true;
+
+	// The update cache depends on the skin's bones and constraints. Path constraints also sort the bones of the path attachments
+	// in the skin and on their target slot, so when there are path constraints those bones are part of the key. The key holds
+	// only indices and constraint data, never skins or attachments, which may be freed and their addresses reused.
+	_skinBones.clear();
+	_skinConstraints.clear();
+	_pathBones.clear();
+	if (_skin) {
+		Vector<BoneData *> &skinBones = _skin->getBones();
+		for (size_t i = 0, n = skinBones.size(); i < n; i++)
+			_skinBones.add(skinBones[i]->getIndex());
+		_skinConstraints.addAll(_skin->getConstraints());
+		if (_skinBones.size() > 1) qsort(_skinBones.buffer(), _skinBones.size(), sizeof(int), compareBoneIndices);
+		if (_skinConstraints.size() > 1)
+			qsort(_skinConstraints.buffer(), _skinConstraints.size(), sizeof(ConstraintData *), compareConstraints);
+	}
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		Slot *slot = _pathConstraints[i]->_target;
+		size_t slotIndex = slot->_data.getIndex();
+		int slotBoneIndex = slot->_bone._data.getIndex();
+		if (_skin) {
+			Skin::AttachmentMap::Entries attachments = _skin->getAttachments();
+			while (attachments.hasNext()) {
+				Skin::AttachmentMap::Entry &entry = attachments.next();
+				if (entry._slotIndex == slotIndex) addPathBones(_pathBones, entry._attachment, slotBoneIndex);
+			}
+		}
+		_pathBones.add(-1);
+		addPathBones(_pathBones, slot->getAttachment(), slotBoneIndex);
+		_pathBones.add(-1);
+	}
+
+	size_t ikCount = _ikConstraints.size(), transformCount = _transformConstraints.size();
+	size_t pathCount = _pathConstraints.size(), boneCount = _bones.size();
+	for (size_t i = 0, n = _skinUpdateCaches.size(); i < n; i++) {
+		SkinUpdateCache *cache = _skinUpdateCaches[i];
+		if (!sameItems(cache->bones, _skinBones) || !sameItems(cache->constraints, _skinConstraints) ||
+			!sameItems(cache->pathBones, _pathBones))
+			continue;
+		if (i < n - 1) {
+			_skinUpdateCaches.removeAt(i);
+			_skinUpdateCaches.add(cache);
+		}
+		_updateCache.clearAndAddAll(cache->updateCache);
+		bool *active = cache->active.buffer();
+		for (size_t ii = 0; ii < boneCount; ii++)
+			_bones[ii]->_active = *active++;
+		for (size_t ii = 0; ii < ikCount; ii++)
+			_ikConstraints[ii]->_active = *active++;
+		for (size_t ii = 0; ii < transformCount; ii++)
+			_transformConstraints[ii]->_active = *active++;
+		for (size_t ii = 0; ii < pathCount; ii++)
+			_pathConstraints[ii]->_active = *active++;
+		return;
+	}
+
+	computeUpdateCache();
+
+	SkinUpdateCache *cache;
+	if (_skinUpdateCaches.size() < maxSkinUpdateCaches)
+		cache = new (__FILE__, __LINE__) SkinUpdateCache();
+	else {
+		// Reuse the least recently used cache.
+		cache = _skinUpdateCaches[0];
+		_skinUpdateCaches.removeAt(0);
+		cache->bones.clear();
+		cache->constraints.clear();
+		cache->pathBones.clear();
+		cache->updateCache.clear();
+		cache->active.clear();
+	}
+	cache->bones.addAll(_skinBones);
+	cache->constraints.addAll(_skinConstraints);
+	cache->pathBones.addAll(_pathBones);
+	cache->updateCache.addAll(_updateCache);
+	cache->active.ensureCapacity(boneCount + ikCount + transformCount + pathCount);
+	for (size_t i = 0; i < boneCount; i++)
+		cache->active.add(_bones[i]->_active);
+	for (size_t i = 0; i < ikCount; i++)
+		cache->active.add(_ikConstraints[i]->_active);
+	for (size_t i = 0; i < transformCount; i++)
+		cache->active.add(_transformConstraints[i]->_active);
+	for (size_t i = 0; i < pathCount; i++)
+		cache->active.add(_pathConstraints[i]->_active);
+	_skinUpdateCaches.add(cache);
+}
+
+void Skeleton::computeUpdateCache() {
 	_updateCache.clear();
 
 	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
@@ -153,43 +325,56 @@ void Skeleton::updateCache() {
 
 	size_t constraintCount = ikCount + transformCount + pathCount;
 
-	size_t i = 0;
-continue_outer:
-	for (; i < constraintCount; ++i) {
-		for (size_t ii = 0; ii < ikCount; ++ii) {
-			IkConstraint *constraint = _ikConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortIkConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
-		}
-
-		for (size_t ii = 0; ii < transformCount; ++ii) {
-			TransformConstraint *constraint = _transformConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortTransformConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
-		}
+	// Index the constraints by order. When constraints share an order, the first IK, then transform, then path constraint is
+	// used. Orders past the constraint count are not sorted.
+	_constraintsByOrder.setSize(constraintCount, NULL);
+	for (size_t i = 0; i < constraintCount; ++i)
+		_constraintsByOrder[i] = NULL;
+	for (size_t i = 0; i < ikCount; ++i) {
+		size_t order = _ikConstraints[i]->getData().getOrder();
+		if (order < constraintCount && !_constraintsByOrder[order]) _constraintsByOrder[order] = _ikConstraints[i];
+	}
+	for (size_t i = 0; i < transformCount; ++i) {
+		size_t order = _transformConstraints[i]->getData().getOrder();
+		if (order < constraintCount && !_constraintsByOrder[order]) _constraintsByOrder[order] = _transformConstraints[i];
+	}
+	for (size_t i = 0; i < pathCount; ++i) {
+		size_t order = _pathConstraints[i]->getData().getOrder();
+		if (order < constraintCount && !_constraintsByOrder[order]) _constraintsByOrder[order] = _pathConstraints[i];
+	}
 
-		for (size_t ii = 0; ii < pathCount; ++ii) {
-			PathConstraint *constraint = _pathConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortPathConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
-		}
+	for (size_t i = 0; i < constraintCount; ++i) {
+		Updatable *constraint = _constraintsByOrder[i];
+		if (!constraint) continue;
+		const RTTI &rtti = constraint->getRTTI();
+		if (rtti.isExactly(IkConstraint::rtti))
+			sortIkConstraint(static_cast<IkConstraint *>(constraint));
+		else if (rtti.isExactly(TransformConstraint::rtti))
+			sortTransformConstraint(static_cast<TransformConstraint *>(constraint));
+		else
+			sortPathConstraint(static_cast<PathConstraint *>(constraint));
 	}
 
-	size_t n = _bones.size();
-	for (i = 0; i < n; ++i) {
+	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
 		sortBone(_bones[i]);
 	}
 }
 
+bool Skeleton::isSkinConstraint(ConstraintData *data) {
+	// _skinConstraints is sorted by updateSkinCache().
+	size_t low = 0, high = _skinConstraints.size();
+	while (low < high) {
+		size_t mid = (low + high) >> 1;
+		ConstraintData *constraint = _skinConstraints[mid];
+		if (constraint == data) return true;
+		if ((size_t) constraint < (size_t) data)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return false;
+}
+
 void Skeleton::printUpdateCache() {
 	for (size_t i = 0; i < _updateCache.size(); i++) {
 		Updatable *updatable = _updateCache[i];
@@ -206,6 +391,42 @@ void Skeleton::printUpdateCache() {
 }
 
 void Skeleton::updateWorldTransform() {
+	if (_changeTracking) {
+		float scaleX = getRootScaleX(), scaleY = getRootScaleY();
+		if (_updateAll || _x != _updatedX || _y != _updatedY || scaleX != _updatedScaleX || scaleY != _updatedScaleY) {
+			if (_updateAll) updateConstrainedBones();
+			_updateAll = false;
+			_updatedX = _x;
+			_updatedY = _y;
+			_updatedScaleX = scaleX;
+			_updatedScaleY = scaleY;
+			if (_bones.size() > 0) _bones[0]->_dirty = true;
+		}
+
+		// A bone is dirty if its local transform differs from the applied transform its world transform was computed from.
+		for (size_t i = 0, n = _bones.size(); i < n; i++) {
+			Bone *bone = _bones[i];
+			if (bone->_ax != bone->_x || bone->_ay != bone->_y || bone->_arotation != bone->_rotation ||
+				bone->_ascaleX != bone->_scaleX || bone->_ascaleY != bone->_scaleY || bone->_ashearX != bone->_shearX ||
+				bone->_ashearY != bone->_shearY) {
+				bone->_dirty = true;
+				bone->_ax = bone->_x;
+				bone->_ay = bone->_y;
+				bone->_arotation = bone->_rotation;
+				bone->_ascaleX = bone->_scaleX;
+				bone->_ascaleY = bone->_scaleY;
+				bone->_ashearX = bone->_shearX;
+				bone->_ashearY = bone->_shearY;
+			}
+			bone->_changed = false;
+		}
+
+		_trackingChanges = true;
+		updateCacheItems();
+		_trackingChanges = false;
+		return;
+	}
+
 	for (size_t i = 0, n = _bones.size(); i < n; i++) {
 		Bone *bone = _bones[i];
 		bone->_ax = bone->_x;
@@ -217,11 +438,134 @@ void Skeleton::updateWorldTransform() {
 		bone->_ashearY = bone->_shearY;
 	}
 
+	updateCacheItems();
+}
+
+void Skeleton::updateCacheItems() {
+#ifndef SPINE_NO_THREADS
+	if (_updatePool) {
+		if (_updateStagesDirty) computeUpdateStages();
+		if (_updateStages.size() > 1 || (_updateStages.size() == 1 && _updateStages[0].threads > 1)) {
+			_updatePool->update(_updateStageOrder, _updateStages);
+			return;
+		}
+	}
+#endif
 	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
 		_updateCache[i]->update();
 	}
 }
 
+#ifndef SPINE_NO_THREADS
+// The lowest level after the last write of a bone that is read.
+static inline int readLevel(Vector<int> &lastWrite, Bone *bone, int level) {
+	return bone ? MathUtil::max(level, lastWrite[bone->getData().getIndex()] + 1) : level;
+}
+
+// The lowest level after the last read or write of a bone that is written.
+static inline int writeLevel(Vector<int> &lastWrite, Vector<int> &lastRead, Bone *bone, int level) {
+	int index = bone->getData().getIndex();
+	return MathUtil::max(level, MathUtil::max(lastWrite[index], lastRead[index]) + 1);
+}
+
+static inline void markRead(Vector<int> &lastRead, Bone *bone, int level) {
+	if (!bone) return;
+	int &read = lastRead[bone->getData().getIndex()];
+	if (read < level) read = level;
+}
+
+void Skeleton::computeUpdateStages() {
+	_updateStagesDirty = false;
+	_updateStageOrder.clear();
+	_updateStages.clear();
+
+	// Assign each updatable the lowest level after every earlier updatable writing a bone it reads or writes, and every
+	// earlier updatable reading a bone it writes. Updatables on the same level are independent, so updating levels in
+	// order gives the same results as updating the cache in order.
+	size_t count = _updateCache.size(), boneCount = _bones.size();
+	Vector<int> lastWrite, lastRead, levels;
+	lastWrite.setSize(boneCount, -1);
+	lastRead.setSize(boneCount, -1);
+	levels.setSize(count, 0);
+	int minLevel = 0, levelCount = 0;
+	for (size_t i = 0; i < count; i++) {
+		Updatable *updatable = _updateCache[i];
+		const RTTI &rtti = updatable->getRTTI();
+		Bone *target = NULL;
+		Vector<Bone *> *bones = NULL;
+		Bone *bone = NULL;
+		if (rtti.isExactly(Bone::rtti)) {
+			bone = static_cast<Bone *>(updatable);
+		} else if (rtti.isExactly(IkConstraint::rtti)) {
+			IkConstraint *constraint = static_cast<IkConstraint *>(updatable);
+			target = constraint->getTarget();
+			bones = &constraint->getBones();
+		} else if (rtti.isExactly(TransformConstraint::rtti)) {
+			TransformConstraint *constraint = static_cast<TransformConstraint *>(updatable);
+			target = constraint->getTarget();
+			bones = &constraint->getBones();
+		}
+
+		int level = minLevel;
+		if (bone) {
+			level = readLevel(lastWrite, bone->_parent, level);
+			level = writeLevel(lastWrite, lastRead, bone, level);
+			markRead(lastRead, bone->_parent, level);
+			lastWrite[bone->getData().getIndex()] = level;
+		} else if (bones) {
+			level = readLevel(lastWrite, target, level);
+			for (size_t ii = 0, nn = bones->size(); ii < nn; ii++) {
+				level = readLevel(lastWrite, (*bones)[ii]->_parent, level);
+				level = writeLevel(lastWrite, lastRead, (*bones)[ii], level);
+			}
+			markRead(lastRead, target, level);
+			for (size_t ii = 0, nn = bones->size(); ii < nn; ii++) {
+				markRead(lastRead, (*bones)[ii]->_parent, level);
+				lastWrite[(*bones)[ii]->getData().getIndex()] = level;
+			}
+		} else {
+			// Path constraints read the bones of their target slot's attachment, which can change without the update cache
+			// changing, so they run after everything before them and before everything after them.
+			level = levelCount;
+			minLevel = level + 1;
+		}
+		levels[i] = level;
+		if (level >= levelCount) levelCount = level + 1;
+	}
+
+	// Order the updatables by level, keeping the cache order within a level.
+	Vector<int> levelStarts;
+	levelStarts.setSize(levelCount + 1, 0);
+	for (size_t i = 0; i < count; i++)
+		levelStarts[levels[i] + 1]++;
+	for (int i = 0; i < levelCount; i++)
+		levelStarts[i + 1] += levelStarts[i];
+	_updateStageOrder.setSize(count, NULL);
+	Vector<int> next;
+	next.addAll(levelStarts);
+	for (size_t i = 0; i < count; i++)
+		_updateStageOrder[next[levels[i]]++] = _updateCache[i];
+
+	// Levels too small to split run on the calling thread, merged with adjacent small levels.
+	int threadCount = _updatePool->getThreadCount(), minPerThread = _updatePool->getMinUpdatablesPerThread();
+	for (int i = 0; i < levelCount; i++) {
+		int start = levelStarts[i], end = levelStarts[i + 1];
+		int threads = MathUtil::min(threadCount, (end - start) / minPerThread);
+		if (threads < 2) threads = 1;
+		size_t stageCount = _updateStages.size();
+		if (threads == 1 && stageCount > 0 && _updateStages[stageCount - 1].threads == 1) {
+			_updateStages[stageCount - 1].end = end;
+			continue;
+		}
+		UpdatePool::Stage stage;
+		stage.start = start;
+		stage.end = end;
+		stage.threads = threads;
+		_updateStages.add(stage);
+	}
+}
+#endif
+
 void Skeleton::updateWorldTransform(Bone *parent) {
 	// Apply the parent bone transform to the root bone. The root bone always inherits scale, rotation and reflection.
 	Bone &rootBone = *getRootBone();
@@ -234,10 +578,11 @@ void Skeleton::updateWorldTransform(Bone *parent) {
 	float lb = MathUtil::cosDeg(rotationY) * rootBone._scaleY;
 	float lc = MathUtil::sinDeg(rootBone._rotation + rootBone._shearX) * rootBone._scaleX;
 	float ld = MathUtil::sinDeg(rotationY) * rootBone._scaleY;
-	rootBone._a = (pa * la + pb * lc) * _scaleX;
-	rootBone._b = (pa * lb + pb * ld) * _scaleX;
-	rootBone._c = (pc * la + pd * lc) * _scaleY;
-	rootBone._d = (pc * lb + pd * ld) * _scaleY;
+	float scaleX = _scaleX * _dataScale, scaleY = _scaleY * _dataScale;
+	rootBone._a = (pa * la + pb * lc) * scaleX;
+	rootBone._b = (pa * lb + pb * ld) * scaleX;
+	rootBone._c = (pc * la + pd * lc) * scaleY;
+	rootBone._d = (pc * lb + pd * ld) * scaleY;
 
 	// Update everything except root bone.
 	Bone *rb = getRootBone();
@@ -245,6 +590,110 @@ void Skeleton::updateWorldTransform(Bone *parent) {
 		Updatable *updatable = _updateCache[i];
 		if (updatable != rb) updatable->update();
 	}
+
+	// The root bone's world transform came from the parent, so the next tracked update must start over.
+	_updateAll = true;
+}
+
+bool Skeleton::isChangeTracking() {
+	return _changeTracking;
+}
+
+void Skeleton::setChangeTracking(bool inValue) {
+	_changeTracking = inValue;
+	_updateAll = true;
+}
+
+#ifndef SPINE_NO_THREADS
+void Skeleton::setUpdatePool(UpdatePool *pool) {
+	_updatePool = pool;
+	_updateStagesDirty = true;
+}
+
+UpdatePool *Skeleton::getUpdatePool() {
+	return _updatePool;
+}
+#endif
+
+static inline void comparePose(float *&pose, float value, bool &changed) {
+	changed |= *pose != value;
+	*pose++ = value;
+}
+
+static inline void compareColor(float *&pose, Color &color, bool &changed) {
+	comparePose(pose, color.r, changed);
+	comparePose(pose, color.g, changed);
+	comparePose(pose, color.b, changed);
+	comparePose(pose, color.a, changed);
+}
+
+size_t Skeleton::getGeneration() {
+	size_t size = _bones.size() * 6 + 4 + _slots.size() * 9;
+	for (size_t i = 0, n = _slots.size(); i < n; ++i)
+		size += _slots[i]->_deform.size();
+
+	bool changed = false;
+	if (_generationPose.size() != size) {
+		_generationPose.setSize(size, 0);
+		changed = true;
+	}
+	float *pose = _generationPose.buffer();
+	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
+		Bone &bone = *_bones[i];
+		comparePose(pose, bone._a, changed);
+		comparePose(pose, bone._b, changed);
+		comparePose(pose, bone._worldX, changed);
+		comparePose(pose, bone._c, changed);
+		comparePose(pose, bone._d, changed);
+		comparePose(pose, bone._worldY, changed);
+	}
+	compareColor(pose, _color, changed);
+	for (size_t i = 0, n = _slots.size(); i < n; ++i) {
+		Slot &slot = *_slots[i];
+		compareColor(pose, slot._color, changed);
+		compareColor(pose, slot._darkColor, changed);
+		Vector<float> &deform = slot._deform;
+		size_t deformSize = deform.size();
+		comparePose(pose, (float) deformSize, changed);
+		if (deformSize > 0 && memcmp(pose, deform.buffer(), sizeof(float) * deformSize) != 0) {
+			memcpy(pose, deform.buffer(), sizeof(float) * deformSize);
+			changed = true;
+		}
+		pose += deformSize;
+	}
+	if (!sameItems(_drawOrder, _generationDrawOrder)) {
+		_generationDrawOrder.clear();
+		_generationDrawOrder.addAll(_drawOrder);
+		changed = true;
+	}
+	if (changed) _generation++;
+	return _generation;
+}
+
+void Skeleton::markChanged() {
+	_generation++;
+}
+
+void Skeleton::updateConstrainedBones() {
+	for (size_t i = 0, n = _bones.size(); i < n; i++) {
+		_bones[i]->_dirty = true;
+		_bones[i]->_constrained = false;
+	}
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; i++) {
+		Vector<Bone *> &bones = _ikConstraints[i]->getBones();
+		for (size_t ii = 0, nn = bones.size(); ii < nn; ii++)
+			bones[ii]->_constrained = true;
+	}
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; i++) {
+		Vector<Bone *> &bones = _transformConstraints[i]->getBones();
+		for (size_t ii = 0, nn = bones.size(); ii < nn; ii++)
+			bones[ii]->_constrained = true;
+	}
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		Vector<Bone *> &bones = _pathConstraints[i]->getBones();
+		for (size_t ii = 0, nn = bones.size(); ii < nn; ii++)
+			bones[ii]->_constrained = true;
+	}
 }
 
 void Skeleton::setToSetupPose() {
@@ -340,7 +789,8 @@ void Skeleton::setSkin(Skin *newSkin) {
 	}
 
 	_skin = newSkin;
-	updateCache();
+	_generation++;
+	updateSkinCache();
 }
 
 Attachment *Skeleton::getAttachment(const String &slotName, const String &attachmentName) {
@@ -470,6 +920,54 @@ void Skeleton::getBounds(float &outX, float &outY, float &outWidth, float &outHe
 	outHeight = maxY - minY;
 }
 
+bool Skeleton::getEstimatedBounds(AnimationState &state, AnimationBounds &bounds, float &outX, float &outY, float &outWidth,
+								  float &outHeight) {
+	float local[4] = {FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX};
+	bool setupPose = true;
+	Vector<TrackEntry *> &tracks = state.getTracks();
+	for (size_t i = 0, n = tracks.size(); i < n; ++i) {
+		for (TrackEntry *entry = tracks[i]; entry != NULL; entry = entry->getMixingFrom()) {
+			Animation *animation = entry->getAnimation();
+			if (i == 0 && entry == tracks[i]) setupPose = false;
+			if (animation->getTimelines().size() == 0) {
+				setupPose = true;
+				continue;
+			}
+			if (entry->getAlpha() < 1 || entry->getMixingFrom() != NULL) setupPose = true;
+			const float *animationBounds;
+			if (!bounds.findBounds(animation, entry->getAnimationTime(), animationBounds)) return false;
+			if (animationBounds[0] > animationBounds[2]) continue;
+			local[0] = MathUtil::min(local[0], animationBounds[0]);
+			local[1] = MathUtil::min(local[1], animationBounds[1]);
+			local[2] = MathUtil::max(local[2], animationBounds[2]);
+			local[3] = MathUtil::max(local[3], animationBounds[3]);
+		}
+	}
+	if (setupPose && bounds._setupBounds[0] <= bounds._setupBounds[2]) {
+		local[0] = MathUtil::min(local[0], bounds._setupBounds[0]);
+		local[1] = MathUtil::min(local[1], bounds._setupBounds[1]);
+		local[2] = MathUtil::max(local[2], bounds._setupBounds[2]);
+		local[3] = MathUtil::max(local[3], bounds._setupBounds[3]);
+	}
+
+	if (local[0] > local[2]) {
+		outX = _x;
+		outY = _y;
+		outWidth = 0;
+		outHeight = 0;
+		return true;
+	}
+	float padding = bounds._padding;
+	float scaleX = _scaleX * _dataScale, scaleY = _scaleY * _dataScale;
+	float x1 = (local[0] - padding) * scaleX, x2 = (local[2] + padding) * scaleX;
+	float y1 = (local[1] - padding) * scaleY, y2 = (local[3] + padding) * scaleY;
+	outX = MathUtil::min(x1, x2) + _x;
+	outY = MathUtil::min(y1, y2) + _y;
+	outWidth = MathUtil::abs(x2 - x1);
+	outHeight = MathUtil::abs(y2 - y1);
+	return true;
+}
+
 Bone *Skeleton::getRootBone() {
 	return _bones.size() == 0 ? NULL : _bones[0];
 }
@@ -551,9 +1049,25 @@ void Skeleton::setScaleY(float inValue) {
 	_scaleY = inValue;
 }
 
+float Skeleton::getDataScale() {
+	return _dataScale;
+}
+
+void Skeleton::setDataScale(float inValue) {
+	_dataScale = inValue;
+}
+
+float Skeleton::getRootScaleX() {
+	return _scaleX * _dataScale;
+}
+
+float Skeleton::getRootScaleY() {
+	return getScaleY() * _dataScale;
+}
+
 void Skeleton::sortIkConstraint(IkConstraint *constraint) {
 	constraint->_active = constraint->_target->_active && (!constraint->_data.isSkinRequired() ||
-														   (_skin && _skin->_constraints.contains(&constraint->_data)));
+														   isSkinConstraint(&constraint->_data));
 	if (!constraint->_active) return;
 
 	Bone *target = constraint->getTarget();
@@ -578,9 +1092,8 @@ void Skeleton::sortIkConstraint(IkConstraint *constraint) {
 }
 
 void Skeleton::sortPathConstraint(PathConstraint *constraint) {
-	constraint->_active = constraint->_target->_bone._active && (!constraint->_data.isSkinRequired() || (_skin &&
-																										 _skin->_constraints.contains(
-																												 &constraint->_data)));
+	constraint->_active = constraint->_target->_bone._active &&
+						  (!constraint->_data.isSkinRequired() || isSkinConstraint(&constraint->_data));
 	if (!constraint->_active) return;
 
 	Slot *slot = constraint->getTarget();
@@ -612,7 +1125,7 @@ void Skeleton::sortPathConstraint(PathConstraint *constraint) {
 
 void Skeleton::sortTransformConstraint(TransformConstraint *constraint) {
 	constraint->_active = constraint->_target->_active && (!constraint->_data.isSkinRequired() ||
-														   (_skin && _skin->_constraints.contains(&constraint->_data)));
+														   isSkinConstraint(&constraint->_data));
 	if (!constraint->_active) return;
 
 	sortBone(constraint->getTarget());
@@ -75,13 +75,14 @@ using namespace spine;
 
 SkeletonBinary::SkeletonBinary(Atlas *atlasArray) : _attachmentLoader(
 															new (__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)),
-													_error(), _scale(1), _ownsLoader(true) {
+													_error(), _scale(1), _quantizeCurves(false), _ownsLoader(true) {
 }
 
 SkeletonBinary::SkeletonBinary(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(
 																							  attachmentLoader),
 																					  _error(),
 																					  _scale(1),
+																					  _quantizeCurves(false),
 																					  _ownsLoader(ownsLoader) {
 	assert(_attachmentLoader != NULL);
 }
@@ -593,16 +594,16 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			}
 			mesh->_path = path;
 			mesh->_color.set(color);
-			mesh->_bones.addAll(bones);
-			mesh->_vertices.addAll(vertices);
+			mesh->_bones = std::move(bones);
+			mesh->_vertices = std::move(vertices);
 			mesh->setWorldVerticesLength(vertexCount << 1);
-			mesh->_triangles.addAll(triangles);
-			mesh->_regionUVs.addAll(uvs);
+			mesh->_triangles = std::move(triangles);
+			mesh->_regionUVs = std::move(uvs);
 			if (sequence == NULL) mesh->updateRegion();
 			mesh->_hullLength = hullLength;
 			mesh->_sequence = sequence;
 			if (nonessential) {
-				mesh->_edges.addAll(edges);
+				mesh->_edges = std::move(edges);
 				mesh->_width = width;
 				mesh->_height = height;
 			}
@@ -724,9 +725,13 @@ void SkeletonBinary::readVertices(DataInput *input, Vector<float> &vertices, Vec
 			vertices.add(readFloat(input));
 		}
 	}
+	// Release the capacity reserved for the worst case, the vectors are kept by the attachment.
+	vertices.shrink();
+	bones.shrink();
 }
 
 void SkeletonBinary::readFloatArray(DataInput *input, int n, float scale, Vector<float> &array) {
+	array.ensureCapacity(n);
 	array.setSize(n, 0);
 
 	int i;
@@ -743,6 +748,7 @@ void SkeletonBinary::readFloatArray(DataInput *input, int n, float scale, Vector
 
 void SkeletonBinary::readShortArray(DataInput *input, Vector<unsigned short> &array) {
 	int n = readVarint(input, true);
+	array.ensureCapacity(n);
 	array.setSize(n, 0);
 
 	int i;
@@ -1258,43 +1264,36 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 						VertexAttachment *attachment = static_cast<VertexAttachment *>(baseAttachment);
 						bool weighted = attachment->_bones.size() > 0;
 						Vector<float> &vertices = attachment->_vertices;
-						int deformLength = weighted ? (int) vertices.size() / 3 * 2 : (int) vertices.size();
 
 						int bezierCount = readVarint(input, true);
 						DeformTimeline *timeline = new (__FILE__, __LINE__) DeformTimeline(frameCount, bezierCount, slotIndex,
 																						   attachment);
 
+						Vector<float> deform;
 						float time = readFloat(input);
 						for (int frame = 0, bezier = 0;; ++frame) {
-							Vector<float> deform;
 							size_t end = (size_t) readVarint(input, true);
 							if (end == 0) {
-								if (weighted) {
-									deform.setSize(deformLength, 0);
-									for (int iiii = 0; iiii < deformLength; ++iiii)
-										deform[iiii] = 0;
-								} else {
-									deform.clearAndAddAll(vertices);
-								}
+								// Setup pose.
+								timeline->setFrame(frame, time, 0, NULL, 0);
 							} else {
-								deform.setSize(deformLength, 0);
 								size_t start = (size_t) readVarint(input, true);
-								end += start;
+								deform.setSize(end, 0);
 								if (scale == 1) {
-									for (size_t v = start; v < end; ++v)
+									for (size_t v = 0; v < end; ++v)
 										deform[v] = readFloat(input);
 								} else {
-									for (size_t v = start; v < end; ++v)
+									for (size_t v = 0; v < end; ++v)
 										deform[v] = readFloat(input) * scale;
 								}
 
 								if (!weighted) {
-									for (size_t v = 0, vn = deform.size(); v < vn; ++v)
-										deform[v] += vertices[v];
+									for (size_t v = 0; v < end; ++v)
+										deform[v] += vertices[start + v];
 								}
+								timeline->setFrame(frame, time, start, deform.buffer(), end);
 							}
 
-							timeline->setFrame(frame, time, deform);
 							if (frame == frameLast) break;
 							float time2 = readFloat(input);
 							switch (readSByte(input)) {
@@ -1396,6 +1395,8 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 	float duration = 0;
 	for (int i = 0, n = (int) timelines.size(); i < n; i++) {
 		duration = MathUtil::max(duration, (timelines[i])->getDuration());
+		if (_quantizeCurves && timelines[i]->getRTTI().instanceOf(CurveTimeline::rtti))
+			static_cast<CurveTimeline *>(timelines[i])->quantizeCurves();
 	}
 	return new (__FILE__, __LINE__) Animation(String(name), timelines, duration);
 }
@@ -53,12 +53,7 @@ void SkeletonBounds::update(Skeleton &skeleton, bool updateAabb) {
 	size_t slotCount = slots.size();
 
 	_boundingBoxes.clear();
-	for (size_t i = 0, n = _polygons.size(); i < n; ++i) {
-		_polygonPool.free(_polygons[i]);
-	}
-
-	_polygons.clear();
-
+	size_t polygonCount = 0;
 	for (size_t i = 0; i < slotCount; i++) {
 		Slot *slot = slots[i];
 		if (!slot->getBone().isActive()) continue;
@@ -68,8 +63,14 @@ void SkeletonBounds::update(Skeleton &skeleton, bool updateAabb) {
 		BoundingBoxAttachment *boundingBox = static_cast<BoundingBoxAttachment *>(attachment);
 		_boundingBoxes.add(boundingBox);
 
-		spine::Polygon *polygonP = _polygonPool.obtain();
-		_polygons.add(polygonP);
+		spine::Polygon *polygonP;
+		if (polygonCount < _polygons.size())
+			polygonP = _polygons[polygonCount];
+		else {
+			polygonP = _polygonPool.obtain();
+			_polygons.add(polygonP);
+		}
+		polygonCount++;
 
 		Polygon &polygon = *polygonP;
 
@@ -79,13 +80,31 @@ void SkeletonBounds::update(Skeleton &skeleton, bool updateAabb) {
 			polygon._vertices.setSize(count, 0);
 		}
 		boundingBox->computeWorldVertices(*slot, polygon._vertices);
+
+		float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+		float *vertices = polygon._vertices.buffer();
+		for (size_t ii = 0; ii < count; ii += 2) {
+			float x = vertices[ii], y = vertices[ii + 1];
+			minX = MathUtil::min(minX, x);
+			minY = MathUtil::min(minY, y);
+			maxX = MathUtil::max(maxX, x);
+			maxY = MathUtil::max(maxY, y);
+		}
+		polygon._minX = minX;
+		polygon._minY = minY;
+		polygon._maxX = maxX;
+		polygon._maxY = maxY;
 	}
+	for (size_t i = polygonCount, n = _polygons.size(); i < n; ++i) {
+		_polygonPool.free(_polygons[i]);
+	}
+	_polygons.setSize(polygonCount, NULL);
 
 	if (updateAabb)
 		aabbCompute();
 	else {
-		_minX = FLT_MIN;
-		_minY = FLT_MIN;
+		_minX = -FLT_MAX;
+		_minY = -FLT_MAX;
 		_maxX = FLT_MAX;
 		_maxY = FLT_MAX;
 	}
@@ -143,14 +162,22 @@ bool SkeletonBounds::containsPoint(spine::Polygon *polygon, float x, float y) {
 }
 
 BoundingBoxAttachment *SkeletonBounds::containsPoint(float x, float y) {
-	for (size_t i = 0, n = _polygons.size(); i < n; ++i)
-		if (containsPoint(_polygons[i], x, y)) return _boundingBoxes[i];
+	for (size_t i = 0, n = _polygons.size(); i < n; ++i) {
+		spine::Polygon *polygon = _polygons[i];
+		if (x < polygon->_minX || x > polygon->_maxX || y < polygon->_minY || y > polygon->_maxY) continue;
+		if (containsPoint(polygon, x, y)) return _boundingBoxes[i];
+	}
 	return NULL;
 }
 
 BoundingBoxAttachment *SkeletonBounds::intersectsSegment(float x1, float y1, float x2, float y2) {
-	for (size_t i = 0, n = _polygons.size(); i < n; ++i)
-		if (intersectsSegment(_polygons[i], x1, y1, x2, y2)) return _boundingBoxes[i];
+	float minX = MathUtil::min(x1, x2), minY = MathUtil::min(y1, y2);
+	float maxX = MathUtil::max(x1, x2), maxY = MathUtil::max(y1, y2);
+	for (size_t i = 0, n = _polygons.size(); i < n; ++i) {
+		spine::Polygon *polygon = _polygons[i];
+		if (maxX < polygon->_minX || minX > polygon->_maxX || maxY < polygon->_minY || minY > polygon->_maxY) continue;
+		if (intersectsSegment(polygon, x1, y1, x2, y2)) return _boundingBoxes[i];
+	}
 	return NULL;
 }
 
@@ -198,6 +225,22 @@ Vector<BoundingBoxAttachment *> &SkeletonBounds::getBoundingBoxes() {
 	return _boundingBoxes;
 }
 
+float SkeletonBounds::getMinX() {
+	return _minX;
+}
+
+float SkeletonBounds::getMinY() {
+	return _minY;
+}
+
+float SkeletonBounds::getMaxX() {
+	return _maxX;
+}
+
+float SkeletonBounds::getMaxY() {
+	return _maxY;
+}
+
 float SkeletonBounds::getWidth() {
 	return _maxX - _minX;
 }
@@ -209,20 +252,15 @@ float SkeletonBounds::getHeight() {
 void SkeletonBounds::aabbCompute() {
 	float minX = FLT_MAX;
 	float minY = FLT_MAX;
-	float maxX = FLT_MIN;
-	float maxY = FLT_MIN;
+	float maxX = -FLT_MAX;
+	float maxY = -FLT_MAX;
 
 	for (size_t i = 0, n = _polygons.size(); i < n; ++i) {
 		spine::Polygon *polygon = _polygons[i];
-		Vector<float> &vertices = polygon->_vertices;
-		for (int ii = 0, nn = polygon->_count; ii < nn; ii += 2) {
-			float x = vertices[ii];
-			float y = vertices[ii + 1];
-			minX = MathUtil::min(minX, x);
-			minY = MathUtil::min(minY, y);
-			maxX = MathUtil::max(maxX, x);
-			maxY = MathUtil::max(maxY, y);
-		}
+		minX = MathUtil::min(minX, polygon->_minX);
+		minY = MathUtil::min(minY, polygon->_minY);
+		maxX = MathUtil::max(maxX, polygon->_maxX);
+		maxY = MathUtil::max(maxY, polygon->_maxY);
 	}
 	_minX = minX;
 	_minY = minY;
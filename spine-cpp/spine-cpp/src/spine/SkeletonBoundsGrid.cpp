@@ -0,0 +1,291 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/SkeletonBoundsGrid.h>
+
+#include <spine/ContainerUtil.h>
+#include <spine/MathUtil.h>
+#include <spine/SkeletonBounds.h>
+
+using namespace spine;
+
+struct SkeletonBoundsGrid::Entry : public SpineObject {
+	SkeletonBounds *bounds;
+	int minCellX, minCellY, maxCellX, maxCellY;
+	bool stored, unbounded;
+	size_t unboundedIndex;
+	int queryId;
+};
+
+// Bounds spanning more cells than this are not stored in cells and are tested by every query instead.
+static const int MaxEntryCells = 64;
+
+static const int QueryPoint = 0, QuerySegment = 1, QueryBox = 2;
+
+static int toCell(float value, float cellSize) {
+	float cell = MathUtil::clamp(value / cellSize, -1e8f, 1e8f);
+	int index = (int) cell;
+	return cell < index ? index - 1 : index;
+}
+
+static float cellsSpanned(int minCellX, int minCellY, int maxCellX, int maxCellY) {
+	return ((float) maxCellX - minCellX + 1) * ((float) maxCellY - minCellY + 1);
+}
+
+SkeletonBoundsGrid::SkeletonBoundsGrid(float cellSize) : _cellSize(cellSize), _cellCount(0), _queryId(0) {
+	assert(cellSize > 0);
+	rehash(64);
+}
+
+SkeletonBoundsGrid::~SkeletonBoundsGrid() {
+	ContainerUtil::cleanUpVectorOfPointers(_entries);
+	ContainerUtil::cleanUpVectorOfPointers(_buckets);
+}
+
+void SkeletonBoundsGrid::add(SkeletonBounds *bounds) {
+	Entry *entry = new (__FILE__, __LINE__) Entry();
+	entry->bounds = bounds;
+	entry->stored = false;
+	entry->queryId = _queryId;
+	_bounds.add(bounds);
+	_entries.add(entry);
+	insert(entry);
+}
+
+void SkeletonBoundsGrid::remove(SkeletonBounds *bounds) {
+	int index = _bounds.indexOf(bounds);
+	if (index == -1) return;
+	Entry *entry = _entries[index];
+	erase(entry);
+	delete entry;
+	size_t last = _bounds.size() - 1;
+	_bounds[index] = _bounds[last];
+	_entries[index] = _entries[last];
+	_bounds.removeAt(last);
+	_entries.removeAt(last);
+}
+
+void SkeletonBoundsGrid::clear() {
+	for (size_t i = 0, n = _buckets.size(); i < n; i++)
+		_buckets[i]->clear();
+	ContainerUtil::cleanUpVectorOfPointers(_entries);
+	_bounds.clear();
+	_unbounded.clear();
+	_cellCount = 0;
+}
+
+void SkeletonBoundsGrid::update() {
+	for (size_t i = 0, n = _entries.size(); i < n; i++) {
+		Entry *entry = _entries[i];
+		SkeletonBounds *bounds = entry->bounds;
+		if (entry->stored && bounds->getMinX() <= bounds->getMaxX() && bounds->getMinY() <= bounds->getMaxY()) {
+			int minCellX = toCell(bounds->getMinX(), _cellSize), minCellY = toCell(bounds->getMinY(), _cellSize);
+			int maxCellX = toCell(bounds->getMaxX(), _cellSize), maxCellY = toCell(bounds->getMaxY(), _cellSize);
+			if (entry->unbounded) {
+				// Still too large to store in cells, so it stays in the unbounded list.
+				if (cellsSpanned(minCellX, minCellY, maxCellX, maxCellY) > MaxEntryCells) continue;
+			} else if (minCellX == entry->minCellX && minCellY == entry->minCellY && maxCellX == entry->maxCellX &&
+					   maxCellY == entry->maxCellY)
+				continue;
+		} else if (!entry->stored && (bounds->getMinX() > bounds->getMaxX() || bounds->getMinY() > bounds->getMaxY()))
+			continue;
+		erase(entry);
+		insert(entry);
+	}
+}
+
+void SkeletonBoundsGrid::insert(Entry *entry) {
+	SkeletonBounds *bounds = entry->bounds;
+	// Bounds without polygons have an empty AABB and are not stored until they have one.
+	if (bounds->getMinX() > bounds->getMaxX() || bounds->getMinY() > bounds->getMaxY()) return;
+	entry->minCellX = toCell(bounds->getMinX(), _cellSize);
+	entry->minCellY = toCell(bounds->getMinY(), _cellSize);
+	entry->maxCellX = toCell(bounds->getMaxX(), _cellSize);
+	entry->maxCellY = toCell(bounds->getMaxY(), _cellSize);
+	float cells = cellsSpanned(entry->minCellX, entry->minCellY, entry->maxCellX, entry->maxCellY);
+	entry->unbounded = cells > MaxEntryCells;
+	if (entry->unbounded) {
+		entry->stored = true;
+		entry->unboundedIndex = _unbounded.size();
+		_unbounded.add(entry);
+		return;
+	}
+	_cellCount += (size_t) cells;
+	if (_cellCount > _buckets.size()) rehash(_buckets.size() * 2);
+	entry->stored = true;
+	for (int y = entry->minCellY; y <= entry->maxCellY; y++)
+		for (int x = entry->minCellX; x <= entry->maxCellX; x++)
+			getBucket(x, y).add(entry);
+}
+
+void SkeletonBoundsGrid::erase(Entry *entry) {
+	if (!entry->stored) return;
+	entry->stored = false;
+	if (entry->unbounded) {
+		Entry *last = _unbounded[_unbounded.size() - 1];
+		_unbounded[entry->unboundedIndex] = last;
+		last->unboundedIndex = entry->unboundedIndex;
+		_unbounded.removeAt(_unbounded.size() - 1);
+		return;
+	}
+	for (int y = entry->minCellY; y <= entry->maxCellY; y++) {
+		for (int x = entry->minCellX; x <= entry->maxCellX; x++) {
+			Vector<Entry *> &bucket = getBucket(x, y);
+			size_t last = bucket.size() - 1;
+			bucket[bucket.indexOf(entry)] = bucket[last];
+			bucket.removeAt(last);
+		}
+	}
+	_cellCount -= (size_t) (entry->maxCellX - entry->minCellX + 1) * (entry->maxCellY - entry->minCellY + 1);
+}
+
+void SkeletonBoundsGrid::rehash(size_t bucketCount) {
+	for (size_t i = 0, n = _buckets.size(); i < n; i++)
+		_buckets[i]->clear();
+	while (_buckets.size() < bucketCount)
+		_buckets.add(new (__FILE__, __LINE__) Vector<Entry *>());
+	for (size_t i = 0, n = _entries.size(); i < n; i++) {
+		Entry *entry = _entries[i];
+		if (!entry->stored || entry->unbounded) continue;
+		for (int y = entry->minCellY; y <= entry->maxCellY; y++)
+			for (int x = entry->minCellX; x <= entry->maxCellX; x++)
+				getBucket(x, y).add(entry);
+	}
+}
+
+Vector<SkeletonBoundsGrid::Entry *> &SkeletonBoundsGrid::getBucket(int cellX, int cellY) {
+	unsigned int hash = ((unsigned int) cellX * 73856093u) ^ ((unsigned int) cellY * 19349663u);
+	return *_buckets[hash & (_buckets.size() - 1)];
+}
+
+void SkeletonBoundsGrid::test(Entry *entry, float x1, float y1, float x2, float y2, int type,
+							  Vector<SkeletonBounds *> &outHits) {
+	if (entry->queryId == _queryId) return;
+	entry->queryId = _queryId;
+	SkeletonBounds *bounds = entry->bounds;
+	switch (type) {
+		case QueryPoint:
+			if (bounds->aabbcontainsPoint(x1, y1) && bounds->containsPoint(x1, y1)) outHits.add(bounds);
+			break;
+		case QuerySegment:
+			if (bounds->aabbintersectsSegment(x1, y1, x2, y2) && bounds->intersectsSegment(x1, y1, x2, y2))
+				outHits.add(bounds);
+			break;
+		default: {
+			if (x2 < bounds->getMinX() || x1 > bounds->getMaxX() || y2 < bounds->getMinY() || y1 > bounds->getMaxY()) break;
+			Vector<Polygon *> &polygons = bounds->getPolygons();
+			for (size_t i = 0, n = polygons.size(); i < n; i++) {
+				Polygon *polygon = polygons[i];
+				if (x2 < polygon->_minX || x1 > polygon->_maxX || y2 < polygon->_minY || y1 > polygon->_maxY) continue;
+				outHits.add(bounds);
+				break;
+			}
+		}
+	}
+}
+
+void SkeletonBoundsGrid::queryCell(int cellX, int cellY, float x1, float y1, float x2, float y2, int type,
+								   Vector<SkeletonBounds *> &outHits) {
+	Vector<Entry *> &bucket = getBucket(cellX, cellY);
+	for (size_t i = 0, n = bucket.size(); i < n; i++)
+		test(bucket[i], x1, y1, x2, y2, type, outHits);
+}
+
+void SkeletonBoundsGrid::containsPoint(float x, float y, Vector<SkeletonBounds *> &outHits) {
+	outHits.clear();
+	_queryId++;
+	for (size_t i = 0, n = _unbounded.size(); i < n; i++)
+		test(_unbounded[i], x, y, x, y, QueryPoint, outHits);
+	queryCell(toCell(x, _cellSize), toCell(y, _cellSize), x, y, x, y, QueryPoint, outHits);
+}
+
+void SkeletonBoundsGrid::intersectsSegment(float x1, float y1, float x2, float y2, Vector<SkeletonBounds *> &outHits) {
+	outHits.clear();
+	_queryId++;
+	for (size_t i = 0, n = _unbounded.size(); i < n; i++)
+		test(_unbounded[i], x1, y1, x2, y2, QuerySegment, outHits);
+
+	float minX = MathUtil::min(x1, x2), maxX = MathUtil::max(x1, x2);
+	float minY = MathUtil::min(y1, y2), maxY = MathUtil::max(y1, y2);
+	int minCellX = toCell(minX, _cellSize), maxCellX = toCell(maxX, _cellSize);
+	int minCellY = toCell(minY, _cellSize), maxCellY = toCell(maxY, _cellSize);
+	if ((float) maxCellX - minCellX + (float) maxCellY - minCellY + 2 > visitLimit()) {
+		testAll(x1, y1, x2, y2, QuerySegment, outHits);
+		return;
+	}
+
+	// Visit the cells the segment passes through, one column at a time.
+	float slope = x1 != x2 ? (y2 - y1) / (x2 - x1) : 0, epsilon = _cellSize * 0.0001f;
+	for (int column = minCellX; column <= maxCellX; column++) {
+		float bottom = minY, top = maxY;
+		if (x1 != x2) {
+			float left = MathUtil::max(minX, column * _cellSize), right = MathUtil::min(maxX, (column + 1) * _cellSize);
+			float leftY = y1 + (left - x1) * slope, rightY = y1 + (right - x1) * slope;
+			bottom = MathUtil::min(leftY, rightY);
+			top = MathUtil::max(leftY, rightY);
+		}
+		for (int row = toCell(bottom - epsilon, _cellSize), last = toCell(top + epsilon, _cellSize); row <= last; row++)
+			queryCell(column, row, x1, y1, x2, y2, QuerySegment, outHits);
+	}
+}
+
+void SkeletonBoundsGrid::intersectsBox(float minX, float minY, float maxX, float maxY, Vector<SkeletonBounds *> &outHits) {
+	outHits.clear();
+	_queryId++;
+	for (size_t i = 0, n = _unbounded.size(); i < n; i++)
+		test(_unbounded[i], minX, minY, maxX, maxY, QueryBox, outHits);
+	int minCellX = toCell(minX, _cellSize), minCellY = toCell(minY, _cellSize);
+	int maxCellX = toCell(maxX, _cellSize), maxCellY = toCell(maxY, _cellSize);
+	if (((float) maxCellX - minCellX + 1) * ((float) maxCellY - minCellY + 1) > visitLimit()) {
+		testAll(minX, minY, maxX, maxY, QueryBox, outHits);
+		return;
+	}
+	for (int y = minCellY; y <= maxCellY; y++)
+		for (int x = minCellX; x <= maxCellX; x++)
+			queryCell(x, y, minX, minY, maxX, maxY, QueryBox, outHits);
+}
+
+float SkeletonBoundsGrid::visitLimit() {
+	// Past this many cells, testing every bounds is cheaper than visiting the cells.
+	return (float) (_entries.size() * 4 + 64);
+}
+
+void SkeletonBoundsGrid::testAll(float x1, float y1, float x2, float y2, int type, Vector<SkeletonBounds *> &outHits) {
+	for (size_t i = 0, n = _entries.size(); i < n; i++)
+		if (_entries[i]->stored) test(_entries[i], x1, y1, x2, y2, type, outHits);
+}
+
+Vector<SkeletonBounds *> &SkeletonBoundsGrid::getBounds() {
+	return _bounds;
+}
+
+float SkeletonBoundsGrid::getCellSize() {
+	return _cellSize;
+}
@@ -99,10 +99,11 @@ static void toColor(Color &color, const char *value, bool hasAlpha) {
 }
 
 SkeletonJson::SkeletonJson(Atlas *atlas) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
-										   _scale(1), _ownsLoader(true) {}
+										   _scale(1), _quantizeCurves(false), _ownsLoader(true) {}
 
 SkeletonJson::SkeletonJson(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
 																				  _scale(1),
+																				  _quantizeCurves(false),
 																				  _ownsLoader(ownsLoader) {
 	assert(_attachmentLoader != NULL);
 }
@@ -122,7 +123,7 @@ SkeletonData *SkeletonJson::readSkeletonDataFile(const String &path) {
 		return NULL;
 	}
 
-	skeletonData = readSkeletonData(json);
+	skeletonData = readSkeletonDataRoot(new (__FILE__, __LINE__) Json(json, length));
 
 	SpineExtension::free(json, __FILE__, __LINE__);
 
@@ -130,15 +131,17 @@ SkeletonData *SkeletonJson::readSkeletonDataFile(const String &path) {
 }
 
 SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
+	return readSkeletonDataRoot(new (__FILE__, __LINE__) Json(json));
+}
+
+SkeletonData *SkeletonJson::readSkeletonDataRoot(Json *root) {
 	int i, ii;
 	SkeletonData *skeletonData;
-	Json *root, *skeleton, *bones, *boneMap, *ik, *transform, *path, *slots, *skins, *animations, *events;
+	Json *skeleton, *bones, *boneMap, *ik, *transform, *path, *slots, *skins, *animations, *events;
 
 	_error = "";
 	_linkedMeshes.clear();
 
-	root = new (__FILE__, __LINE__) Json(json);
-
 	if (!root) {
 		setError(NULL, "Invalid skeleton JSON: ", Json::getError());
 		return NULL;
@@ -1277,42 +1280,37 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 					if (timelineName == "deform") {
 						VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
 						bool weighted = vertexAttachment->_bones.size() != 0;
-						Vector<float> &verts = vertexAttachment->_vertices;
-						int deformLength = weighted ? (int) verts.size() / 3 * 2 : (int) verts.size();
 
 						DeformTimeline *timeline = new (__FILE__, __LINE__) DeformTimeline(frames,
 																						   frames, slotIndex, vertexAttachment);
+						Vector<float> deformed;
 						float time = Json::getFloat(keyMap, "time", 0);
 						for (frame = 0, bezier = 0;; frame++) {
 							Json *vertices = Json::getItem(keyMap, "vertices");
-							Vector<float> deformed;
 							if (!vertices) {
-								if (weighted) {
-									deformed.setSize(deformLength, 0);
-								} else {
-									deformed.clearAndAddAll(vertexAttachment->_vertices);
-								}
+								// Setup pose.
+								timeline->setFrame(frame, time, 0, NULL, 0);
 							} else {
-								deformed.setSize(deformLength, 0);
 								int v, start = Json::getInt(keyMap, "offset", 0);
+								deformed.setSize(vertices->_size, 0);
 								Json *vertex;
 								if (_scale == 1) {
-									for (vertex = vertices->_child, v = start; vertex; vertex = vertex->_next, ++v) {
+									for (vertex = vertices->_child, v = 0; vertex; vertex = vertex->_next, ++v) {
 										deformed[v] = vertex->_valueFloat;
 									}
 								} else {
-									for (vertex = vertices->_child, v = start; vertex; vertex = vertex->_next, ++v) {
+									for (vertex = vertices->_child, v = 0; vertex; vertex = vertex->_next, ++v) {
 										deformed[v] = vertex->_valueFloat * _scale;
 									}
 								}
 								if (!weighted) {
 									Vector<float> &verticesAttachment = vertexAttachment->_vertices;
-									for (v = 0; v < deformLength; ++v) {
-										deformed[v] += verticesAttachment[v];
+									for (v = 0; v < vertices->_size; ++v) {
+										deformed[v] += verticesAttachment[start + v];
 									}
 								}
+								timeline->setFrame(frame, time, start, deformed.buffer(), vertices->_size);
 							}
-							timeline->setFrame(frame, time, deformed);
 							nextMap = keyMap->_next;
 							if (!nextMap) {
 								// timeline.shrink(); // BOZO
@@ -1422,8 +1420,11 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 	}
 
 	float duration = 0;
-	for (size_t i = 0; i < timelines.size(); i++)
+	for (size_t i = 0; i < timelines.size(); i++) {
 		duration = MathUtil::max(duration, timelines[i]->getDuration());
+		if (_quantizeCurves && timelines[i]->getRTTI().instanceOf(CurveTimeline::rtti))
+			static_cast<CurveTimeline *>(timelines[i])->quantizeCurves();
+	}
 	return new (__FILE__, __LINE__) Animation(String(root->_name), timelines, duration);
 }
 
@@ -1447,7 +1448,7 @@ void SkeletonJson::readVertices(Json *attachmentMap, VertexAttachment *attachmen
 				vertices[i] *= _scale;
 		}
 
-		attachment->getVertices().clearAndAddAll(vertices);
+		attachment->getVertices() = std::move(vertices);
 		return;
 	}
 
@@ -1466,8 +1467,11 @@ void SkeletonJson::readVertices(Json *attachmentMap, VertexAttachment *attachmen
 		}
 	}
 
-	attachment->getVertices().clearAndAddAll(bonesAndWeights._vertices);
-	attachment->getBones().clearAndAddAll(bonesAndWeights._bones);
+	// Release the capacity reserved for the worst case, the vectors are kept by the attachment.
+	bonesAndWeights._vertices.shrink();
+	bonesAndWeights._bones.shrink();
+	attachment->getVertices() = std::move(bonesAndWeights._vertices);
+	attachment->getBones() = std::move(bonesAndWeights._bones);
 }
 
 void SkeletonJson::setError(Json *root, const String &value1, const String &value2) {
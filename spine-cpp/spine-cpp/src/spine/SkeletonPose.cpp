@@ -0,0 +1,424 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/SkeletonPose.h>
+
+#include <spine/AnimationState.h>
+#include <spine/Bone.h>
+#include <spine/IkConstraint.h>
+#include <spine/PathConstraint.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+#include <spine/TransformConstraint.h>
+
+using namespace spine;
+
+template<typename T>
+static inline void write(char *&cursor, const T &value) {
+	memcpy(cursor, &value, sizeof(T));
+	cursor += sizeof(T);
+}
+
+template<typename T>
+static inline void read(const char *&cursor, T &value) {
+	memcpy(&value, cursor, sizeof(T));
+	cursor += sizeof(T);
+}
+
+static inline void writeFloats(char *&cursor, Vector<float> &values) {
+	size_t n = values.size();
+	write(cursor, n);
+	if (n == 0) return;
+	memcpy(cursor, values.buffer(), n * sizeof(float));
+	cursor += n * sizeof(float);
+}
+
+static inline void readFloats(const char *&cursor, Vector<float> &values) {
+	size_t n;
+	read(cursor, n);
+	values.setSize(n, 0);
+	if (n == 0) return;
+	memcpy(values.buffer(), cursor, n * sizeof(float));
+	cursor += n * sizeof(float);
+}
+
+static inline void writeColor(char *&cursor, Color &color) {
+	write(cursor, color.r);
+	write(cursor, color.g);
+	write(cursor, color.b);
+	write(cursor, color.a);
+}
+
+static inline void readColor(const char *&cursor, Color &color) {
+	read(cursor, color.r);
+	read(cursor, color.g);
+	read(cursor, color.b);
+	read(cursor, color.a);
+}
+
+static const size_t skeletonSize = sizeof(Skin *) + sizeof(float) * 9 + sizeof(size_t) * 5;
+static const size_t boneSize = sizeof(float) * 20;
+static const size_t slotSize = sizeof(float) * 8 + sizeof(Attachment *) + sizeof(int) * 2 + sizeof(size_t);
+static const size_t ikConstraintSize = sizeof(float) * 2 + sizeof(int) + sizeof(bool) * 2;
+static const size_t transformConstraintSize = sizeof(float) * 6;
+static const size_t pathConstraintSize = sizeof(float) * 5;
+static const size_t trackEntryTimesSize = sizeof(TrackEntry *) + sizeof(size_t) + sizeof(float) * 9 + sizeof(size_t);
+
+SkeletonPose::SkeletonPose() : _buffer(NULL), _size(0), _capacity(0), _stateOffset(0) {
+}
+
+SkeletonPose::~SkeletonPose() {
+	if (_buffer) SpineExtension::free(_buffer, __FILE__, __LINE__);
+}
+
+void SkeletonPose::capture(Skeleton &skeleton) {
+	captureSkeleton(skeleton, 0);
+}
+
+void SkeletonPose::capture(Skeleton &skeleton, AnimationState &state) {
+	Vector<TrackEntry *> &tracks = state._tracks;
+	size_t stateSize = sizeof(int) + sizeof(size_t) * (tracks.size() + 1);
+	for (size_t i = 0, n = tracks.size(); i < n; ++i) {
+		TrackEntry *current = tracks[i];
+		if (!current) continue;
+		for (TrackEntry *entry = current; entry; entry = entry->_mixingFrom)
+			stateSize += trackEntrySize(entry);
+		for (TrackEntry *entry = current->_next; entry; entry = entry->_next)
+			stateSize += trackEntrySize(entry);
+	}
+
+	captureSkeleton(skeleton, stateSize);
+
+	char *cursor = _buffer + _stateOffset;
+	write(cursor, state._unkeyedState);
+	write(cursor, tracks.size());
+	for (size_t i = 0, n = tracks.size(); i < n; ++i) {
+		TrackEntry *current = tracks[i];
+		size_t count = 0;
+		if (current) {
+			for (TrackEntry *entry = current; entry; entry = entry->_mixingFrom)
+				count++;
+			for (TrackEntry *entry = current->_next; entry; entry = entry->_next)
+				count++;
+		}
+		write(cursor, count);
+		if (!current) continue;
+		for (TrackEntry *entry = current; entry; entry = entry->_mixingFrom)
+			captureTrackEntry(cursor, entry);
+		for (TrackEntry *entry = current->_next; entry; entry = entry->_next)
+			captureTrackEntry(cursor, entry);
+	}
+}
+
+void SkeletonPose::restore(Skeleton &skeleton) {
+	assert(_buffer);
+
+	const char *cursor = _buffer;
+	Skin *skin;
+	read(cursor, skin);
+	if (skeleton._skin != skin) skeleton.setSkin(skin);
+	readColor(cursor, skeleton._color);
+	read(cursor, skeleton._x);
+	read(cursor, skeleton._y);
+	read(cursor, skeleton._scaleX);
+	read(cursor, skeleton._scaleY);
+	read(cursor, skeleton._dataScale);
+	skeleton._updateAll = true;
+
+	size_t boneCount, slotCount, ikCount, transformCount, pathCount;
+	read(cursor, boneCount);
+	read(cursor, slotCount);
+	read(cursor, ikCount);
+	read(cursor, transformCount);
+	read(cursor, pathCount);
+	assert(boneCount == skeleton._bones.size());
+	assert(slotCount == skeleton._slots.size());
+	assert(ikCount == skeleton._ikConstraints.size());
+	assert(transformCount == skeleton._transformConstraints.size());
+	assert(pathCount == skeleton._pathConstraints.size());
+
+	for (size_t i = 0; i < boneCount; ++i) {
+		Bone &bone = *skeleton._bones[i];
+		read(cursor, bone._x);
+		read(cursor, bone._y);
+		read(cursor, bone._rotation);
+		read(cursor, bone._scaleX);
+		read(cursor, bone._scaleY);
+		read(cursor, bone._shearX);
+		read(cursor, bone._shearY);
+		read(cursor, bone._ax);
+		read(cursor, bone._ay);
+		read(cursor, bone._arotation);
+		read(cursor, bone._ascaleX);
+		read(cursor, bone._ascaleY);
+		read(cursor, bone._ashearX);
+		read(cursor, bone._ashearY);
+		read(cursor, bone._a);
+		read(cursor, bone._b);
+		read(cursor, bone._worldX);
+		read(cursor, bone._c);
+		read(cursor, bone._d);
+		read(cursor, bone._worldY);
+	}
+
+	for (size_t i = 0; i < slotCount; ++i) {
+		Slot &slot = *skeleton._slots[i];
+		readColor(cursor, slot._color);
+		readColor(cursor, slot._darkColor);
+		read(cursor, slot._attachment);
+		read(cursor, slot._attachmentState);
+		read(cursor, slot._sequenceIndex);
+		readFloats(cursor, slot._deform);
+	}
+
+	for (size_t i = 0; i < ikCount; ++i) {
+		IkConstraint &constraint = *skeleton._ikConstraints[i];
+		read(cursor, constraint._mix);
+		read(cursor, constraint._softness);
+		read(cursor, constraint._bendDirection);
+		read(cursor, constraint._compress);
+		read(cursor, constraint._stretch);
+	}
+
+	for (size_t i = 0; i < transformCount; ++i) {
+		TransformConstraint &constraint = *skeleton._transformConstraints[i];
+		read(cursor, constraint._mixRotate);
+		read(cursor, constraint._mixX);
+		read(cursor, constraint._mixY);
+		read(cursor, constraint._mixScaleX);
+		read(cursor, constraint._mixScaleY);
+		read(cursor, constraint._mixShearY);
+	}
+
+	for (size_t i = 0; i < pathCount; ++i) {
+		PathConstraint &constraint = *skeleton._pathConstraints[i];
+		read(cursor, constraint._position);
+		read(cursor, constraint._spacing);
+		read(cursor, constraint._mixRotate);
+		read(cursor, constraint._mixX);
+		read(cursor, constraint._mixY);
+	}
+
+	Slot **drawOrder = skeleton._drawOrder.buffer();
+	Slot **slots = skeleton._slots.buffer();
+	for (size_t i = 0; i < slotCount; ++i) {
+		int slotIndex;
+		read(cursor, slotIndex);
+		drawOrder[i] = slots[slotIndex];
+	}
+	skeleton._generation++;
+}
+
+bool SkeletonPose::restore(Skeleton &skeleton, AnimationState &state) {
+	if (!_stateOffset) return false;
+
+	/* Check the tracks still hold the captured entries before changing the skeleton or any entry. Entries are pooled, so an
+	 * entry at a captured address may since have been reused for another animation: the serial number tells them apart. */
+	Vector<TrackEntry *> &tracks = state._tracks;
+	const char *cursor = _buffer + _stateOffset + sizeof(int);
+	size_t trackCount;
+	read(cursor, trackCount);
+	for (size_t i = 0; i < trackCount; ++i) {
+		TrackEntry *current = i < tracks.size() ? tracks[i] : NULL;
+		size_t count;
+		read(cursor, count);
+		TrackEntry *entry = current;
+		bool queued = false;
+		for (size_t ii = 0; ii < count; ++ii) {
+			if (!entry && !queued) {
+				entry = current ? current->_next : NULL;
+				queued = true;
+			}
+			TrackEntry *captured;
+			size_t serial;
+			read(cursor, captured);
+			read(cursor, serial);
+			if (entry != captured || entry->_serial != serial) return false;
+			size_t rotations;
+			cursor += sizeof(float) * 9;
+			read(cursor, rotations);
+			cursor += sizeof(float) * rotations;
+			entry = queued ? entry->_next : entry->_mixingFrom;
+		}
+		if (entry || (!queued && current && current->_next)) return false;
+	}
+	for (size_t i = trackCount, n = tracks.size(); i < n; ++i)
+		if (tracks[i]) return false;
+
+	restore(skeleton);
+	cursor = _buffer + _stateOffset;
+	read(cursor, state._unkeyedState);
+	cursor += sizeof(size_t);
+	for (size_t i = 0; i < trackCount; ++i) {
+		size_t count;
+		read(cursor, count);
+		for (size_t ii = 0; ii < count; ++ii) {
+			TrackEntry *entry;
+			read(cursor, entry);
+			cursor += sizeof(size_t);
+			restoreTrackEntry(cursor, entry);
+		}
+	}
+	return true;
+}
+
+size_t SkeletonPose::getSize() {
+	return _size;
+}
+
+void SkeletonPose::captureSkeleton(Skeleton &skeleton, size_t stateSize) {
+	size_t boneCount = skeleton._bones.size(), slotCount = skeleton._slots.size();
+	size_t ikCount = skeleton._ikConstraints.size(), transformCount = skeleton._transformConstraints.size();
+	size_t pathCount = skeleton._pathConstraints.size();
+
+	size_t size = skeletonSize + boneSize * boneCount + (slotSize + sizeof(int)) * slotCount +
+				  ikConstraintSize * ikCount + transformConstraintSize * transformCount + pathConstraintSize * pathCount;
+	for (size_t i = 0; i < slotCount; ++i)
+		size += sizeof(float) * skeleton._slots[i]->_deform.size();
+
+	_stateOffset = stateSize ? size : 0;
+	_size = size + stateSize;
+	if (_capacity < _size) {
+		_capacity = _size;
+		_buffer = SpineExtension::realloc(_buffer, _capacity, __FILE__, __LINE__);
+	}
+
+	char *cursor = _buffer;
+	write(cursor, skeleton._skin);
+	writeColor(cursor, skeleton._color);
+	write(cursor, skeleton._x);
+	write(cursor, skeleton._y);
+	write(cursor, skeleton._scaleX);
+	write(cursor, skeleton._scaleY);
+	write(cursor, skeleton._dataScale);
+	write(cursor, boneCount);
+	write(cursor, slotCount);
+	write(cursor, ikCount);
+	write(cursor, transformCount);
+	write(cursor, pathCount);
+
+	for (size_t i = 0; i < boneCount; ++i) {
+		Bone &bone = *skeleton._bones[i];
+		write(cursor, bone._x);
+		write(cursor, bone._y);
+		write(cursor, bone._rotation);
+		write(cursor, bone._scaleX);
+		write(cursor, bone._scaleY);
+		write(cursor, bone._shearX);
+		write(cursor, bone._shearY);
+		write(cursor, bone._ax);
+		write(cursor, bone._ay);
+		write(cursor, bone._arotation);
+		write(cursor, bone._ascaleX);
+		write(cursor, bone._ascaleY);
+		write(cursor, bone._ashearX);
+		write(cursor, bone._ashearY);
+		write(cursor, bone._a);
+		write(cursor, bone._b);
+		write(cursor, bone._worldX);
+		write(cursor, bone._c);
+		write(cursor, bone._d);
+		write(cursor, bone._worldY);
+	}
+
+	for (size_t i = 0; i < slotCount; ++i) {
+		Slot &slot = *skeleton._slots[i];
+		writeColor(cursor, slot._color);
+		writeColor(cursor, slot._darkColor);
+		write(cursor, slot._attachment);
+		write(cursor, slot._attachmentState);
+		write(cursor, slot._sequenceIndex);
+		writeFloats(cursor, slot._deform);
+	}
+
+	for (size_t i = 0; i < ikCount; ++i) {
+		IkConstraint &constraint = *skeleton._ikConstraints[i];
+		write(cursor, constraint._mix);
+		write(cursor, constraint._softness);
+		write(cursor, constraint._bendDirection);
+		write(cursor, constraint._compress);
+		write(cursor, constraint._stretch);
+	}
+
+	for (size_t i = 0; i < transformCount; ++i) {
+		TransformConstraint &constraint = *skeleton._transformConstraints[i];
+		write(cursor, constraint._mixRotate);
+		write(cursor, constraint._mixX);
+		write(cursor, constraint._mixY);
+		write(cursor, constraint._mixScaleX);
+		write(cursor, constraint._mixScaleY);
+		write(cursor, constraint._mixShearY);
+	}
+
+	for (size_t i = 0; i < pathCount; ++i) {
+		PathConstraint &constraint = *skeleton._pathConstraints[i];
+		write(cursor, constraint._position);
+		write(cursor, constraint._spacing);
+		write(cursor, constraint._mixRotate);
+		write(cursor, constraint._mixX);
+		write(cursor, constraint._mixY);
+	}
+
+	for (size_t i = 0; i < slotCount; ++i)
+		write(cursor, skeleton._drawOrder[i]->_data.getIndex());
+}
+
+size_t SkeletonPose::trackEntrySize(TrackEntry *entry) {
+	return trackEntryTimesSize + sizeof(float) * entry->_timelinesRotation.size();
+}
+
+void SkeletonPose::captureTrackEntry(char *&cursor, TrackEntry *entry) {
+	write(cursor, entry);
+	write(cursor, entry->_serial);
+	write(cursor, entry->_trackTime);
+	write(cursor, entry->_trackLast);
+	write(cursor, entry->_nextTrackLast);
+	write(cursor, entry->_animationLast);
+	write(cursor, entry->_nextAnimationLast);
+	write(cursor, entry->_delay);
+	write(cursor, entry->_mixTime);
+	write(cursor, entry->_interruptAlpha);
+	write(cursor, entry->_totalAlpha);
+	writeFloats(cursor, entry->_timelinesRotation);
+}
+
+void SkeletonPose::restoreTrackEntry(const char *&cursor, TrackEntry *entry) {
+	read(cursor, entry->_trackTime);
+	read(cursor, entry->_trackLast);
+	read(cursor, entry->_nextTrackLast);
+	read(cursor, entry->_animationLast);
+	read(cursor, entry->_nextAnimationLast);
+	read(cursor, entry->_delay);
+	read(cursor, entry->_mixTime);
+	read(cursor, entry->_interruptAlpha);
+	read(cursor, entry->_totalAlpha);
+	readFloats(cursor, entry->_timelinesRotation);
+}
@@ -0,0 +1,294 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/SkeletonRenderer.h>
+
+#include <spine/Bone.h>
+#include <spine/ClippingAttachment.h>
+#include <spine/MathUtil.h>
+#include <spine/MeshAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+#include <spine/TextureRegion.h>
+
+#include <string.h>
+
+using namespace spine;
+
+static unsigned short quadIndices[6] = {0, 1, 2, 2, 3, 0};
+
+static bool isLittleEndian() {
+	unsigned int one = 1;
+	return *(unsigned char *) &one == 1;
+}
+
+VertexFormat::VertexFormat(size_t vertexStride, int positionBytes, int uvBytes, int colorBytes, int darkColorBytes)
+	: stride(vertexStride), positionOffset(positionBytes), uvOffset(uvBytes), colorOffset(colorBytes),
+	  darkColorOffset(darkColorBytes) {
+	if (isLittleEndian())
+		setColorShifts(0, 8, 16, 24);
+	else
+		setColorShifts(24, 16, 8, 0);
+}
+
+void VertexFormat::setColorShifts(int red, int green, int blue, int alpha) {
+	redShift = red;
+	greenShift = green;
+	blueShift = blue;
+	alphaShift = alpha;
+}
+
+static unsigned int packColor(const VertexFormat &format, float r, float g, float b, float a) {
+	return ((unsigned int) (unsigned char) (r * 255) << format.redShift) |
+		   ((unsigned int) (unsigned char) (g * 255) << format.greenShift) |
+		   ((unsigned int) (unsigned char) (b * 255) << format.blueShift) |
+		   ((unsigned int) (unsigned char) (a * 255) << format.alphaShift);
+}
+
+SkeletonRenderer::SkeletonRenderer(const VertexFormat &format) : _format(format),
+																 _premultipliedAlpha(false),
+																 _skeletonId(0),
+																 _generation(0),
+																 _vertices(NULL),
+																 _vertexCount(0),
+																 _vertexCapacity(0) {
+	assert(format.stride % sizeof(float) == 0);
+	assert(format.positionOffset % (int) sizeof(float) == 0 && format.uvOffset % (int) sizeof(float) == 0);
+}
+
+SkeletonRenderer::~SkeletonRenderer() {
+	if (_vertices) SpineExtension::free(_vertices, __FILE__, __LINE__);
+}
+
+bool SkeletonRenderer::render(Skeleton &skeleton) {
+	size_t generation = skeleton.getGeneration();
+	if (_skeletonId == skeleton._id && _generation == generation) return false;
+	_skeletonId = skeleton._id;
+	_generation = generation;
+
+	_vertexCount = 0;
+	_indices.clear();
+	_commands.clear();
+
+	const VertexFormat &format = _format;
+	size_t floatStride = format.stride / sizeof(float);
+	Color &skeletonColor = skeleton.getColor();
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0, n = drawOrder.size(); i < n; i++) {
+		Slot &slot = *drawOrder[i];
+		Attachment *attachment = slot.getAttachment();
+		if (!attachment || slot.getColor().a == 0 || !slot.getBone().isActive()) {
+			_clipper.clipEnd(slot);
+			continue;
+		}
+
+		RegionAttachment *region = NULL;
+		MeshAttachment *mesh = NULL;
+		Color *attachmentColor;
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			region = static_cast<RegionAttachment *>(attachment);
+			attachmentColor = &region->getColor();
+		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+			mesh = static_cast<MeshAttachment *>(attachment);
+			attachmentColor = &mesh->getColor();
+		} else {
+			if (attachment->getRTTI().isExactly(ClippingAttachment::rtti))
+				_clipper.clipStart(slot, static_cast<ClippingAttachment *>(attachment));
+			else
+				_clipper.clipEnd(slot);
+			continue;
+		}
+
+		Color &slotColor = slot.getColor();
+		float a = skeletonColor.a * slotColor.a * attachmentColor->a;
+		if (a == 0) {
+			_clipper.clipEnd(slot);
+			continue;
+		}
+		float r = skeletonColor.r * slotColor.r * attachmentColor->r;
+		float g = skeletonColor.g * slotColor.g * attachmentColor->g;
+		float b = skeletonColor.b * slotColor.b * attachmentColor->b;
+		if (_premultipliedAlpha) {
+			r *= a;
+			g *= a;
+			b *= a;
+		}
+
+		size_t vertexCount = region ? 4 : mesh->getWorldVerticesLength() >> 1;
+		unsigned short *indices = region ? quadIndices : mesh->getTriangles().buffer();
+		size_t indexCount = region ? 6 : mesh->getTriangles().size();
+		unsigned char *vertices;
+		float *uvs;
+		if (!_clipper.isClipping() && format.positionOffset >= 0) {
+			// Write the world vertices directly into the vertex buffer.
+			vertices = addVertices(vertexCount);
+			float *positions = (float *) (vertices + format.positionOffset);
+			if (region)
+				region->computeWorldVertices(slot, positions, 0, floatStride);
+			else
+				mesh->computeWorldVertices(slot, 0, vertexCount << 1, positions, 0, floatStride);
+			uvs = region ? region->getUVs().buffer() : mesh->getUVs().buffer();
+		} else {
+			_worldVertices.setSize(vertexCount << 1, 0);
+			if (region)
+				region->computeWorldVertices(slot, _worldVertices.buffer(), 0, 2);
+			else
+				mesh->computeWorldVertices(slot, 0, vertexCount << 1, _worldVertices.buffer(), 0, 2);
+			float *worldVertices = _worldVertices.buffer();
+			uvs = region ? region->getUVs().buffer() : mesh->getUVs().buffer();
+			if (_clipper.isClipping()) {
+				_clipper.clipTriangles(worldVertices, indices, indexCount, uvs, 2);
+				if (_clipper.getClippedTriangles().size() == 0) {
+					_clipper.clipEnd(slot);
+					continue;
+				}
+				worldVertices = _clipper.getClippedVertices().buffer();
+				uvs = _clipper.getClippedUVs().buffer();
+				vertexCount = _clipper.getClippedVertices().size() >> 1;
+				indices = _clipper.getClippedTriangles().buffer();
+				indexCount = _clipper.getClippedTriangles().size();
+			}
+			vertices = addVertices(vertexCount);
+			if (format.positionOffset >= 0) {
+				unsigned char *vertex = vertices + format.positionOffset;
+				for (size_t ii = 0; ii < vertexCount; ii++, vertex += format.stride) {
+					((float *) vertex)[0] = worldVertices[ii << 1];
+					((float *) vertex)[1] = worldVertices[(ii << 1) + 1];
+				}
+			}
+		}
+
+		if (format.uvOffset >= 0) {
+			unsigned char *vertex = vertices + format.uvOffset;
+			for (size_t ii = 0; ii < vertexCount; ii++, vertex += format.stride) {
+				((float *) vertex)[0] = uvs[ii << 1];
+				((float *) vertex)[1] = uvs[(ii << 1) + 1];
+			}
+		}
+		if (format.colorOffset >= 0) {
+			unsigned int color = packColor(format, r, g, b, a);
+			unsigned char *vertex = vertices + format.colorOffset;
+			for (size_t ii = 0; ii < vertexCount; ii++, vertex += format.stride)
+				memcpy(vertex, &color, sizeof(unsigned int));
+		}
+		if (format.darkColorOffset >= 0) {
+			float darkAlpha = _premultipliedAlpha ? 1.0f : 0.0f;
+			unsigned int darkColor = packColor(format, 0, 0, 0, darkAlpha);
+			if (slot.hasDarkColor()) {
+				Color &dark = slot.getDarkColor();
+				darkColor = packColor(format, dark.r, dark.g, dark.b, darkAlpha);
+			}
+			unsigned char *vertex = vertices + format.darkColorOffset;
+			for (size_t ii = 0; ii < vertexCount; ii++, vertex += format.stride)
+				memcpy(vertex, &darkColor, sizeof(unsigned int));
+		}
+
+		TextureRegion *textureRegion = region ? region->getRegion() : mesh->getRegion();
+		addCommand(textureRegion ? textureRegion->rendererObject : NULL, slot.getData().getBlendMode(), vertexCount,
+				   indices, indexCount);
+		_clipper.clipEnd(slot);
+	}
+	_clipper.clipEnd();
+	return true;
+}
+
+unsigned char *SkeletonRenderer::addVertices(size_t count) {
+	size_t vertexCount = _vertexCount + count;
+	if (vertexCount > _vertexCapacity) {
+		_vertexCapacity = MathUtil::max(vertexCount, (size_t) (_vertexCapacity * 1.75f) + 8);
+		_vertices = SpineExtension::realloc<unsigned char>(_vertices, _vertexCapacity * _format.stride, __FILE__,
+														   __LINE__);
+	}
+	unsigned char *vertices = _vertices + _vertexCount * _format.stride;
+	_vertexCount = vertexCount;
+	return vertices;
+}
+
+void SkeletonRenderer::addCommand(void *texture, BlendMode blendMode, size_t vertexCount, const unsigned short *indices,
+								  size_t indexCount) {
+	size_t vertexStart = _vertexCount - vertexCount;
+	size_t indexStart = _indices.size();
+	_indices.setSize(indexStart + indexCount, 0);
+	unsigned short *out = _indices.buffer() + indexStart;
+
+	// Append to the last command if the indices of both fit in 16 bits.
+	if (_commands.size() > 0) {
+		RenderCommand &last = _commands[_commands.size() - 1];
+		if (last.texture == texture && last.blendMode == blendMode && last.vertexCount + vertexCount <= 0x10000) {
+			unsigned short offset = (unsigned short) last.vertexCount;
+			for (size_t i = 0; i < indexCount; i++)
+				out[i] = (unsigned short) (indices[i] + offset);
+			last.vertexCount += vertexCount;
+			last.indexCount += indexCount;
+			return;
+		}
+	}
+
+	memcpy(out, indices, indexCount * sizeof(unsigned short));
+	RenderCommand command;
+	command.texture = texture;
+	command.blendMode = blendMode;
+	command.vertexStart = vertexStart;
+	command.vertexCount = vertexCount;
+	command.indexStart = indexStart;
+	command.indexCount = indexCount;
+	_commands.add(command);
+}
+
+const VertexFormat &SkeletonRenderer::getVertexFormat() {
+	return _format;
+}
+
+bool SkeletonRenderer::getPremultipliedAlpha() {
+	return _premultipliedAlpha;
+}
+
+void SkeletonRenderer::setPremultipliedAlpha(bool premultipliedAlpha) {
+	_premultipliedAlpha = premultipliedAlpha;
+	_skeletonId = 0;
+}
+
+void *SkeletonRenderer::getVertices() {
+	return _vertices;
+}
+
+size_t SkeletonRenderer::getVertexCount() {
+	return _vertexCount;
+}
+
+Vector<unsigned short> &SkeletonRenderer::getIndices() {
+	return _indices;
+}
+
+Vector<RenderCommand> &SkeletonRenderer::getCommands() {
+	return _commands;
+}
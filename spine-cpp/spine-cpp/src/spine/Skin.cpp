@@ -45,11 +45,11 @@ Skin::AttachmentMap::AttachmentMap() {
 
 static void disposeAttachment(Attachment *attachment) {
 	if (!attachment) return;
-	attachment->dereference();
-	if (attachment->getRefCount() == 0) delete attachment;
+	if (attachment->dereference() == 0) delete attachment;
 }
 
-void Skin::AttachmentMap::put(size_t slotIndex, const String &attachmentName, Attachment *attachment) {
+void Skin::AttachmentMap::put(size_t slotIndex, const String &attachmentName, Attachment *attachment,
+							  bool copyOnWrite) {
 	if (slotIndex >= _buckets.size())
 		_buckets.setSize(slotIndex + 1, Vector<Entry>());
 	Vector<Entry> &bucket = _buckets[slotIndex];
@@ -58,8 +58,9 @@ void Skin::AttachmentMap::put(size_t slotIndex, const String &attachmentName, At
 	if (existing >= 0) {
 		disposeAttachment(bucket[existing]._attachment);
 		bucket[existing]._attachment = attachment;
+		bucket[existing]._copyOnWrite = copyOnWrite;
 	} else {
-		bucket.add(Entry(slotIndex, attachmentName, attachment));
+		bucket.add(Entry(slotIndex, attachmentName, attachment, copyOnWrite));
 	}
 }
 
@@ -109,6 +110,29 @@ Attachment *Skin::getAttachment(size_t slotIndex, const String &name) {
 	return _attachments.get(slotIndex, name);
 }
 
+Attachment *Skin::getWritableAttachment(size_t slotIndex, const String &name) {
+	if (slotIndex >= _attachments._buckets.size()) return NULL;
+	Vector<AttachmentMap::Entry> &bucket = _attachments._buckets[slotIndex];
+	int index = _attachments.findInBucket(bucket, name);
+	if (index < 0) return NULL;
+	AttachmentMap::Entry &entry = bucket[index];
+	if (entry._copyOnWrite) {
+		entry._copyOnWrite = false;
+		// No copy is needed once the other skins sharing the attachment have copied it or were disposed.
+		if (entry._attachment->getRefCount() > 1) {
+			Attachment *copy;
+			if (entry._attachment->getRTTI().isExactly(MeshAttachment::rtti))
+				copy = static_cast<MeshAttachment *>(entry._attachment)->newLinkedMesh();
+			else
+				copy = entry._attachment->copy();
+			copy->reference();
+			disposeAttachment(entry._attachment);
+			entry._attachment = copy;
+		}
+	}
+	return entry._attachment;
+}
+
 void Skin::removeAttachment(size_t slotIndex, const String &name) {
 	_attachments.remove(slotIndex, name);
 }
@@ -186,6 +210,20 @@ void Skin::copySkin(Skin *other) {
 	}
 }
 
+void Skin::shareSkin(Skin *other) {
+	for (size_t i = 0; i < other->getBones().size(); i++)
+		if (!_bones.contains(other->getBones()[i])) _bones.add(other->getBones()[i]);
+
+	for (size_t i = 0; i < other->getConstraints().size(); i++)
+		if (!_constraints.contains(other->getConstraints()[i])) _constraints.add(other->getConstraints()[i]);
+
+	AttachmentMap::Entries entries = other->getAttachments();
+	while (entries.hasNext()) {
+		AttachmentMap::Entry &entry = entries.next();
+		_attachments.put(entry._slotIndex, entry._name, entry._attachment, true);
+	}
+}
+
 Vector<ConstraintData *> &Skin::getConstraints() {
 	return _constraints;
 }
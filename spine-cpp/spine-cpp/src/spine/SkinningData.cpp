@@ -0,0 +1,310 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/SkinningData.h>
+
+#include <spine/Bone.h>
+#include <spine/BoneData.h>
+#include <spine/ContainerUtil.h>
+#include <spine/MeshAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+#include <spine/Skin.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+
+using namespace spine;
+
+static const unsigned short quadTriangles[6] = {0, 1, 2, 2, 3, 0};
+
+SkinningAttachment::SkinningAttachment(size_t slotIndex, Attachment *attachment, size_t vertexOffset, size_t vertexCount,
+									   size_t triangleOffset, size_t triangleCount) : _slotIndex(slotIndex),
+																					  _attachment(attachment),
+																					  _vertexOffset(vertexOffset),
+																					  _vertexCount(vertexCount),
+																					  _triangleOffset(triangleOffset),
+																					  _triangleCount(triangleCount) {
+}
+
+size_t SkinningAttachment::getSlotIndex() {
+	return _slotIndex;
+}
+
+Attachment *SkinningAttachment::getAttachment() {
+	return _attachment;
+}
+
+size_t SkinningAttachment::getVertexOffset() {
+	return _vertexOffset;
+}
+
+size_t SkinningAttachment::getVertexCount() {
+	return _vertexCount;
+}
+
+size_t SkinningAttachment::getTriangleOffset() {
+	return _triangleOffset;
+}
+
+size_t SkinningAttachment::getTriangleCount() {
+	return _triangleCount;
+}
+
+static bool isSkinned(Attachment *attachment) {
+	return attachment->getRTTI().isExactly(RegionAttachment::rtti) ||
+		   attachment->getRTTI().isExactly(MeshAttachment::rtti);
+}
+
+static void collectAttachments(Skin *skin, Vector<Vector<Attachment *> > &slotAttachments) {
+	Skin::AttachmentMap::Entries entries = skin->getAttachments();
+	while (entries.hasNext()) {
+		Skin::AttachmentMap::Entry &entry = entries.next();
+		if (!isSkinned(entry._attachment)) continue;
+		Vector<Attachment *> &attachments = slotAttachments[entry._slotIndex];
+		if (!attachments.contains(entry._attachment)) attachments.add(entry._attachment);
+	}
+}
+
+SkinningData::SkinningData(SkeletonData &skeletonData, Skin *skin) : _skeletonData(skeletonData),
+																	 _skin(skin),
+																	 _influenceCount(1) {
+	Vector<Vector<Attachment *> > slotAttachments;
+	slotAttachments.setSize(skeletonData.getSlots().size(), Vector<Attachment *>());
+	if (skin) collectAttachments(skin, slotAttachments);
+	Skin *defaultSkin = skeletonData.getDefaultSkin();
+	if (defaultSkin && defaultSkin != skin) collectAttachments(defaultSkin, slotAttachments);
+
+	// Every vertex stores the most influences of any vertex, so the buffers have a fixed stride.
+	for (size_t i = 0, n = slotAttachments.size(); i < n; i++) {
+		for (size_t ii = 0, nn = slotAttachments[i].size(); ii < nn; ii++) {
+			Attachment *attachment = slotAttachments[i][ii];
+			if (!attachment->getRTTI().isExactly(MeshAttachment::rtti)) continue;
+			Vector<int> &bones = static_cast<MeshAttachment *>(attachment)->getBones();
+			for (size_t v = 0, nv = bones.size(); v < nv; v += bones[v] + 1)
+				if ((size_t) bones[v] > _influenceCount) _influenceCount = bones[v];
+		}
+	}
+
+	_slotAttachments.setSize(slotAttachments.size() + 1, 0);
+	for (size_t i = 0, n = slotAttachments.size(); i < n; i++) {
+		_slotAttachments[i] = _attachments.size();
+		for (size_t ii = 0, nn = slotAttachments[i].size(); ii < nn; ii++)
+			addAttachment(i, slotAttachments[i][ii]);
+	}
+	_slotAttachments[slotAttachments.size()] = _attachments.size();
+}
+
+SkinningData::~SkinningData() {
+	ContainerUtil::cleanUpVectorOfPointers(_attachments);
+}
+
+void SkinningData::addAttachment(size_t slotIndex, Attachment *attachment) {
+	size_t vertexOffset = _uvs.size() >> 1, triangleOffset = _triangles.size();
+	addVertices(slotIndex, attachment);
+	if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+		for (int i = 0; i < 6; i++)
+			_triangles.add(quadTriangles[i]);
+	} else
+		_triangles.addAll(static_cast<MeshAttachment *>(attachment)->getTriangles());
+	_attachments.add(new (__FILE__, __LINE__) SkinningAttachment(slotIndex, attachment, vertexOffset,
+																 (_uvs.size() >> 1) - vertexOffset, triangleOffset,
+																 _triangles.size() - triangleOffset));
+}
+
+void SkinningData::addVertices(size_t slotIndex, Attachment *attachment) {
+	size_t influenceCount = _influenceCount;
+	unsigned short slotBone = (unsigned short) _skeletonData.getSlots()[slotIndex]->getBoneData().getIndex();
+	if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+		// Same vertex order as RegionAttachment::computeWorldVertices(): br, bl, ul, ur.
+		static const int corners[4] = {RegionAttachment::BRX, RegionAttachment::BLX, RegionAttachment::ULX,
+									   RegionAttachment::URX};
+		RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+		Vector<float> &offset = region->getOffset();
+		for (int i = 0; i < 4; i++) {
+			for (size_t k = 0; k < influenceCount; k++) {
+				_boneIndices.add(slotBone);
+				_weights.add(k == 0 ? 1 : 0);
+				_positions.add(k == 0 ? offset[corners[i]] : 0);
+				_positions.add(k == 0 ? offset[corners[i] + 1] : 0);
+			}
+		}
+		_uvs.addAll(region->getUVs());
+		return;
+	}
+
+	MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+	Vector<int> &bones = mesh->getBones();
+	Vector<float> &vertices = mesh->getVertices();
+	if (bones.size() == 0) {
+		for (size_t v = 0, n = vertices.size(); v < n; v += 2) {
+			for (size_t k = 0; k < influenceCount; k++) {
+				_boneIndices.add(slotBone);
+				_weights.add(k == 0 ? 1 : 0);
+				_positions.add(k == 0 ? vertices[v] : 0);
+				_positions.add(k == 0 ? vertices[v + 1] : 0);
+			}
+		}
+	} else {
+		for (size_t v = 0, b = 0, n = bones.size(); v < n;) {
+			size_t count = bones[v++];
+			unsigned short firstBone = (unsigned short) bones[v];
+			for (size_t k = 0; k < influenceCount; k++) {
+				if (k < count) {
+					_boneIndices.add((unsigned short) bones[v++]);
+					_positions.add(vertices[b]);
+					_positions.add(vertices[b + 1]);
+					_weights.add(vertices[b + 2]);
+					b += 3;
+				} else {
+					_boneIndices.add(firstBone);
+					_positions.add(0);
+					_positions.add(0);
+					_weights.add(0);
+				}
+			}
+		}
+	}
+	_uvs.addAll(mesh->getUVs());
+}
+
+SkeletonData &SkinningData::getSkeletonData() {
+	return _skeletonData;
+}
+
+Skin *SkinningData::getSkin() {
+	return _skin;
+}
+
+size_t SkinningData::getInfluenceCount() {
+	return _influenceCount;
+}
+
+Vector<SkinningAttachment *> &SkinningData::getAttachments() {
+	return _attachments;
+}
+
+SkinningAttachment *SkinningData::findAttachment(size_t slotIndex, Attachment *attachment) {
+	if (slotIndex + 1 >= _slotAttachments.size()) return NULL;
+	for (size_t i = _slotAttachments[slotIndex], n = _slotAttachments[slotIndex + 1]; i < n; i++)
+		if (_attachments[i]->_attachment == attachment) return _attachments[i];
+	return NULL;
+}
+
+Vector<unsigned short> &SkinningData::getBoneIndices() {
+	return _boneIndices;
+}
+
+Vector<float> &SkinningData::getWeights() {
+	return _weights;
+}
+
+Vector<float> &SkinningData::getPositions() {
+	return _positions;
+}
+
+Vector<float> &SkinningData::getUVs() {
+	return _uvs;
+}
+
+Vector<unsigned short> &SkinningData::getTriangles() {
+	return _triangles;
+}
+
+void SkinningData::computeBonePalette(Skeleton &skeleton, Vector<float> &palette) {
+	Vector<Bone *> &bones = skeleton.getBones();
+	palette.setSize(bones.size() * 6, 0);
+	float *p = palette.buffer();
+	for (size_t i = 0, n = bones.size(); i < n; i++, p += 6) {
+		Bone &bone = *bones[i];
+		p[0] = bone.getA();
+		p[1] = bone.getB();
+		p[2] = bone.getC();
+		p[3] = bone.getD();
+		p[4] = bone.getWorldX();
+		p[5] = bone.getWorldY();
+	}
+}
+
+bool SkinningData::computeDeformedPositions(Slot &slot, SkinningAttachment &attachment, Vector<float> &positions) {
+	Vector<float> &deform = slot.getDeform();
+	if (deform.size() == 0 || !attachment._attachment->getRTTI().isExactly(MeshAttachment::rtti)) return false;
+
+	size_t influenceCount = _influenceCount, stride = influenceCount << 1;
+	size_t start = attachment._vertexOffset * stride;
+	positions.setSize(attachment._vertexCount * stride, 0);
+	float *out = positions.buffer();
+	MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment._attachment);
+	Vector<int> &bones = mesh->getBones();
+	if (bones.size() == 0) {
+		// Unweighted meshes store deformed positions rather than offsets.
+		for (size_t i = 0, n = attachment._vertexCount; i < n; i++, out += stride) {
+			out[0] = deform[i << 1];
+			out[1] = deform[(i << 1) + 1];
+			for (size_t k = 2; k < stride; k++)
+				out[k] = _positions[start + i * stride + k];
+		}
+		return true;
+	}
+
+	// Weighted meshes store an offset for each influence.
+	const float *in = _positions.buffer() + start;
+	for (size_t v = 0, f = 0, n = bones.size(); v < n; in += stride, out += stride) {
+		size_t count = bones[v];
+		v += count + 1;
+		size_t k = 0;
+		for (; k < count << 1; k++, f++)
+			out[k] = in[k] + deform[f];
+		for (; k < stride; k++)
+			out[k] = in[k];
+	}
+	return true;
+}
+
+void SkinningData::computeWorldVertices(SkinningAttachment &attachment, const float *palette,
+										const float *deformedPositions, float *worldVertices, size_t offset,
+										size_t stride) {
+	size_t influenceCount = _influenceCount;
+	size_t first = attachment._vertexOffset * influenceCount;
+	const unsigned short *boneIndices = _boneIndices.buffer() + first;
+	const float *weights = _weights.buffer() + first;
+	const float *positions = deformedPositions ? deformedPositions : _positions.buffer() + (first << 1);
+	for (size_t i = 0, w = offset, n = attachment._vertexCount; i < n; i++, w += stride) {
+		float wx = 0, wy = 0;
+		for (size_t k = 0; k < influenceCount; k++, boneIndices++, weights++, positions += 2) {
+			const float *bone = palette + *boneIndices * 6;
+			float vx = positions[0], vy = positions[1], weight = *weights;
+			wx += (vx * bone[0] + vy * bone[1] + bone[4]) * weight;
+			wy += (vx * bone[2] + vy * bone[3] + bone[5]) * weight;
+		}
+		worldVertices[w] = wx;
+		worldVertices[w + 1] = wy;
+	}
+}
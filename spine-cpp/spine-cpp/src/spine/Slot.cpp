@@ -106,6 +106,7 @@ void Slot::setAttachment(Attachment *inValue) {
 
 	_attachment = inValue;
 	_sequenceIndex = -1;
+	_skeleton.markChanged();
 }
 
 int Slot::getAttachmentState() {
@@ -125,5 +126,7 @@ int Slot::getSequenceIndex() {
 }
 
 void Slot::setSequenceIndex(int index) {
+	if (_sequenceIndex == index) return;
 	_sequenceIndex = index;
+	_skeleton.markChanged();
 }
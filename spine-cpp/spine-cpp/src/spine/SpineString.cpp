@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/SpineString.h>
+
+#include <stddef.h>
+
+using namespace spine;
+
+namespace {
+	struct InternEntry {
+		InternEntry *next;
+		size_t hash;
+		size_t refCount;
+		char chars[1];
+	};
+
+	InternEntry **internBuckets = NULL;
+	size_t internBucketCount = 0;
+	size_t internCount = 0;
+
+	size_t hashChars(const char *chars, size_t length) {
+		size_t hash = 2166136261u;
+		for (size_t i = 0; i < length; i++)
+			hash = (hash ^ (unsigned char) chars[i]) * 16777619u;
+		return hash;
+	}
+
+	InternEntry *toEntry(char *chars) {
+		return (InternEntry *) (chars - offsetof(InternEntry, chars));
+	}
+
+	void resizeInternTable(size_t bucketCount) {
+		InternEntry **buckets = SpineExtension::calloc<InternEntry *>(bucketCount, __FILE__, __LINE__);
+		for (size_t i = 0; i < internBucketCount; i++) {
+			InternEntry *entry = internBuckets[i];
+			while (entry) {
+				InternEntry *next = entry->next;
+				size_t index = entry->hash & (bucketCount - 1);
+				entry->next = buckets[index];
+				buckets[index] = entry;
+				entry = next;
+			}
+		}
+		if (internBuckets) SpineExtension::free(internBuckets, __FILE__, __LINE__);
+		internBuckets = buckets;
+		internBucketCount = bucketCount;
+	}
+}
+
+bool String::_interning = false;
+
+void String::setInterning(bool interning) {
+	_interning = interning;
+}
+
+bool String::getInterning() {
+	return _interning;
+}
+
+size_t String::getInternedCount() {
+	return internCount;
+}
+
+char *String::intern(const char *chars, size_t length) {
+	size_t hash = hashChars(chars, length);
+	if (internBucketCount > 0) {
+		for (InternEntry *entry = internBuckets[hash & (internBucketCount - 1)]; entry; entry = entry->next) {
+			if (entry->hash == hash && memcmp(entry->chars, chars, length) == 0 && entry->chars[length] == 0) {
+				entry->refCount++;
+				return entry->chars;
+			}
+		}
+	}
+
+	if (internCount >= internBucketCount) resizeInternTable(internBucketCount > 0 ? internBucketCount << 1 : 256);
+	InternEntry *entry = (InternEntry *) SpineExtension::alloc<char>(offsetof(InternEntry, chars) + length + 1, __FILE__,
+																   __LINE__);
+	entry->hash = hash;
+	entry->refCount = 1;
+	memcpy(entry->chars, chars, length);
+	entry->chars[length] = 0;
+	size_t index = hash & (internBucketCount - 1);
+	entry->next = internBuckets[index];
+	internBuckets[index] = entry;
+	internCount++;
+	return entry->chars;
+}
+
+void String::retainInterned(char *chars) {
+	toEntry(chars)->refCount++;
+}
+
+void String::releaseInterned(char *chars) {
+	InternEntry *entry = toEntry(chars);
+	if (--entry->refCount > 0) return;
+
+	InternEntry **link = &internBuckets[entry->hash & (internBucketCount - 1)];
+	while (*link != entry)
+		link = &(*link)->next;
+	*link = entry->next;
+	SpineExtension::free(entry, __FILE__, __LINE__);
+
+	// Free the table with the last entry, so it doesn't outlive the strings using it.
+	if (--internCount == 0) {
+		SpineExtension::free(internBuckets, __FILE__, __LINE__);
+		internBuckets = NULL;
+		internBucketCount = 0;
+	}
+}
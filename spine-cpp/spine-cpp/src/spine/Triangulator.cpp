@@ -195,6 +195,9 @@ Vector<Vector<float> *> &Triangulator::decompose(Vector<float> &vertices, Vector
 	if (polygon->size() > 0) {
 		convexPolygons.add(polygon);
 		convexPolygonsIndices.add(polygonIndices);
+	} else {
+		_polygonPool.free(polygon);
+		_polygonIndicesPool.free(polygonIndices);
 	}
 
 	// Go through the list of polygons and try to merge the remaining triangles with the found triangle fans.
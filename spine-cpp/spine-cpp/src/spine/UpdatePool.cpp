@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated September 24, 2021. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2021, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/UpdatePool.h>
+
+#ifndef SPINE_NO_THREADS
+
+#include <spine/Updatable.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace spine;
+
+struct UpdatePool::Shared : public SpineObject {
+	std::mutex runMutex;
+	std::mutex mutex;
+	std::condition_variable started;
+	std::vector<std::thread> threads;
+	int threadCount;
+	size_t generation;
+	bool exit;
+
+	// The current update, set while runMutex is held.
+	Updatable **updatables;
+	Stage *stages;
+	size_t stageCount;
+
+	std::atomic<int> arrived;
+	std::atomic<unsigned int> barrierGeneration;
+
+	Shared() : threadCount(1), generation(0), exit(false), updatables(NULL), stages(NULL), stageCount(0), arrived(0),
+			   barrierGeneration(0) {
+	}
+
+	// Returns once all threads arrived. Stages are short, so this spins instead of sleeping, yielding in case there are
+	// fewer cores than threads.
+	void barrier() {
+		unsigned int current = barrierGeneration.load(std::memory_order_acquire);
+		if (arrived.fetch_add(1, std::memory_order_acq_rel) + 1 == threadCount) {
+			arrived.store(0, std::memory_order_relaxed);
+			barrierGeneration.fetch_add(1, std::memory_order_release);
+			return;
+		}
+		while (barrierGeneration.load(std::memory_order_acquire) == current)
+			std::this_thread::yield();
+	}
+};
+
+UpdatePool::UpdatePool(int numThreads, int minUpdatablesPerThread)
+	: _shared(new (__FILE__, __LINE__) Shared()), _threadCount(numThreads < 1 ? 1 : numThreads),
+	  _minUpdatablesPerThread(minUpdatablesPerThread < 1 ? 1 : minUpdatablesPerThread) {
+	_shared->threadCount = _threadCount;
+	for (int i = 1; i < _threadCount; i++)
+		_shared->threads.push_back(std::thread(work, _shared, i));
+}
+
+UpdatePool::~UpdatePool() {
+	{
+		std::lock_guard<std::mutex> lock(_shared->mutex);
+		_shared->exit = true;
+	}
+	_shared->started.notify_all();
+	for (size_t i = 0; i < _shared->threads.size(); i++)
+		_shared->threads[i].join();
+	delete _shared;
+}
+
+void UpdatePool::update(Vector<Updatable *> &updatables, Vector<Stage> &stages) {
+	std::lock_guard<std::mutex> runLock(_shared->runMutex);
+	{
+		std::lock_guard<std::mutex> lock(_shared->mutex);
+		_shared->updatables = updatables.buffer();
+		_shared->stages = stages.buffer();
+		_shared->stageCount = stages.size();
+		_shared->generation++;
+	}
+	_shared->started.notify_all();
+	run(_shared, 0);
+}
+
+void UpdatePool::work(Shared *shared, int thread) {
+	size_t generation = 0;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(shared->mutex);
+			shared->started.wait(lock, [shared, generation] { return shared->exit || shared->generation != generation; });
+			if (shared->exit) return;
+			generation = shared->generation;
+		}
+		run(shared, thread);
+	}
+}
+
+void UpdatePool::run(Shared *shared, int thread) {
+	// Once past the last barrier the calling thread may start the next update, so the job is copied before the first.
+	Updatable **updatables = shared->updatables;
+	Stage *stages = shared->stages;
+	size_t stageCount = shared->stageCount;
+	for (size_t i = 0; i < stageCount; i++) {
+		Stage &stage = stages[i];
+		if (thread < stage.threads) {
+			// Each thread updates a contiguous range, so the split is the same every update.
+			int count = stage.end - stage.start;
+			int start = stage.start + count * thread / stage.threads;
+			int end = stage.start + count * (thread + 1) / stage.threads;
+			for (int ii = start; ii < end; ii++)
+				updatables[ii]->update();
+		}
+		// The last barrier lets the calling thread return only once all threads are done.
+		shared->barrier();
+	}
+}
+
+#endif
@@ -34,6 +34,10 @@
 #include <spine/Bone.h>
 #include <spine/Skeleton.h>
 
+#ifndef SPINE_NO_THREADS
+#include <atomic>
+#endif
+
 using namespace spine;
 
 RTTI_IMPL(VertexAttachment, Attachment)
@@ -155,7 +159,12 @@ void VertexAttachment::setTimelineAttachment(Attachment *attachment) {
 }
 
 int VertexAttachment::getNextID() {
+	// Attachments may be loaded on several threads.
+#ifndef SPINE_NO_THREADS
+	static std::atomic<int> nextID(0);
+#else
 	static int nextID = 0;
+#endif
 	return nextID++;
 }
 
@@ -3040,6 +3040,91 @@ class Skeleton {
   void setScaleY(double scaleY) {
     _bindings.spine_skeleton_set_scale_y(_skeleton, scaleY);
   }
+
+  /// Returns a number that changes when anything affecting how the skeleton is rendered changed since a previous call.
+  /// Setting a slot's attachment or sequence index or the skin increments it. The bones' world transforms, the skeleton
+  /// and slot colors, the slots' deform and the draw order are compared with their values at the previous call.
+  int getGeneration() {
+    return _bindings.spine_skeleton_get_generation(_skeleton);
+  }
+
+  /// Increments the generation, for changes that it does not detect, such as to an attachment's color or region.
+  void markChanged() {
+    _bindings.spine_skeleton_mark_changed(_skeleton);
+  }
+
+  /// Returns the world transforms of the bones with the given indices in [getBones], or of all bones, using a single native
+  /// call. Each bone has 6 values: a, b, c, d, worldX and worldY, see [Bone.getA] to [Bone.getWorldY]. If [out] is given,
+  /// it is filled and returned instead of allocating a new list, so it can be reused every frame.
+  Float32List getBoneWorldTransforms([List<int>? boneIndices, Float32List? out]) {
+    final numBones = boneIndices?.length ?? _bindings.spine_skeleton_get_num_bones(_skeleton);
+    final values = _checkOut(out, 6 * numBones);
+    final transforms = _getScratchFloats(6 * numBones);
+    final result =
+        _bindings.spine_skeleton_get_bone_world_transforms(_skeleton, _toNativeIndices(boneIndices), numBones, transforms);
+    if (result < 0) throw Exception("Bone index out of range: $boneIndices");
+    values.setRange(0, 6 * numBones, transforms.asTypedList(6 * numBones));
+    return values;
+  }
+
+  /// Returns the colors of the slots with the given indices in [getSlots], or of all slots, using a single native call. Each
+  /// slot has 4 values: r, g, b and a, see [Slot.getColor]. If [out] is given, it is filled and returned instead of
+  /// allocating a new list.
+  Float32List getSlotColors([List<int>? slotIndices, Float32List? out]) {
+    final numSlots = slotIndices?.length ?? _bindings.spine_skeleton_get_num_slots(_skeleton);
+    final values = _checkOut(out, 4 * numSlots);
+    final colors = _getScratchFloats(4 * numSlots);
+    final result = _bindings.spine_skeleton_get_slot_colors(_skeleton, _toNativeIndices(slotIndices), numSlots, colors);
+    if (result < 0) throw Exception("Slot index out of range: $slotIndices");
+    values.setRange(0, 4 * numSlots, colors.asTypedList(4 * numSlots));
+    return values;
+  }
+
+  /// Sets the local transforms of the bones with the given indices in [getBones], or of the first bones, using a single native
+  /// call. Each bone has 7 values: x, y, rotation, scaleX, scaleY, shearX and shearY, see [Bone.setX] to [Bone.setShearY].
+  /// Passing the same [Float32List] every frame avoids allocating.
+  void setBoneLocalTransforms(List<double> transforms, [List<int>? boneIndices]) {
+    final numBones = boneIndices?.length ?? transforms.length ~/ 7;
+    if (transforms.length < numBones * 7) throw Exception("Expected ${numBones * 7} values, got ${transforms.length}");
+    final nativeTransforms = _getScratchFloats(7 * numBones);
+    nativeTransforms.asTypedList(7 * numBones).setRange(0, 7 * numBones, transforms);
+    final result = _bindings.spine_skeleton_set_bone_local_transforms(
+        _skeleton, _toNativeIndices(boneIndices), numBones, nativeTransforms);
+    if (result < 0) throw Exception("Bone index out of range: $boneIndices");
+  }
+
+  // Native buffers shared by the bulk accessors. They only grow, so the accessors don't allocate native memory on every
+  // call. An isolate runs on a single thread, so one set of buffers is enough.
+  static Pointer<Float> _scratchFloats = nullptr;
+  static int _scratchFloatsCapacity = 0;
+  static Pointer<Int32> _scratchIndices = nullptr;
+  static int _scratchIndicesCapacity = 0;
+
+  static Float32List _checkOut(Float32List? out, int length) {
+    if (out == null) return Float32List(length);
+    if (out.length < length) throw Exception("Expected space for $length values, got ${out.length}");
+    return out;
+  }
+
+  static Pointer<Float> _getScratchFloats(int length) {
+    if (length > _scratchFloatsCapacity || _scratchFloatsCapacity == 0) {
+      if (_scratchFloatsCapacity > 0) _allocator.free(_scratchFloats);
+      _scratchFloatsCapacity = length < 64 ? 64 : length;
+      _scratchFloats = _allocator.allocate(4 * _scratchFloatsCapacity).cast();
+    }
+    return _scratchFloats;
+  }
+
+  static Pointer<Int32> _toNativeIndices(List<int>? indices) {
+    if (indices == null) return nullptr;
+    if (indices.length > _scratchIndicesCapacity || _scratchIndicesCapacity == 0) {
+      if (_scratchIndicesCapacity > 0) _allocator.free(_scratchIndices);
+      _scratchIndicesCapacity = indices.length < 64 ? 64 : indices.length;
+      _scratchIndices = _allocator.allocate(4 * _scratchIndicesCapacity).cast();
+    }
+    _scratchIndices.asTypedList(indices.length).setAll(0, indices);
+    return _scratchIndices;
+  }
 }
 
 /// Stores a list of timelines to animate a skeleton's pose over time.
@@ -3679,7 +3764,11 @@ class AnimationState {
   /// Increments each track entry [TrackEntry.getTrackTime], setting queued animations as current if needed.
   void update(double delta) {
     _bindings.spine_animation_state_update(_state, delta);
+    _dispatchEvents();
+  }
 
+  /// Calls the listeners with the events queued by the native animation state, then clears them.
+  void _dispatchEvents() {
     final numEvents = _bindings.spine_animation_state_events_get_num_events(_events);
     if (numEvents > 0) {
       for (int i = 0; i < numEvents; i++) {
@@ -3908,6 +3997,8 @@ class SkeletonDrawable {
   late final AnimationState animationState;
   final bool _ownsAtlasAndSkeletonData;
   bool _disposed;
+  List<RenderCommand>? _renderCommands;
+  int _renderGeneration = 0;
 
   /// Constructs a new skeleton drawable from the given (possibly shared) [Atlas] and [SkeletonData]. If
   /// the atlas and skeleton data are not shared, the drawable can take ownership by passing true for [_ownsAtlasAndSkeletonData].
@@ -3961,10 +4052,19 @@ class SkeletonDrawable {
   }
 
   /// Renders to current skeleton pose to a list of [RenderCommand] instances. The render commands
-  /// can be rendered via [Canvas.drawVertices].
+  /// can be rendered via [Canvas.drawVertices]. If the skeleton's generation did not change since the
+  /// previous call, the previous render commands are returned. See [Skeleton.getGeneration].
   List<RenderCommand> render() {
     if (_disposed) return [];
-    spine_render_command nativeCmd = _bindings.spine_skeleton_drawable_render(_drawable);
+    final generation = skeleton.getGeneration();
+    if (_renderCommands != null && generation == _renderGeneration) return _renderCommands!;
+    final commands = _toRenderCommands(_bindings.spine_skeleton_drawable_render(_drawable));
+    _renderCommands = commands;
+    _renderGeneration = generation;
+    return commands;
+  }
+
+  List<RenderCommand> _toRenderCommands(spine_render_command nativeCmd) {
     List<RenderCommand> commands = [];
     while (nativeCmd.address != nullptr.address) {
       final atlasPage = atlas.atlasPages[_bindings.spine_render_command_get_atlas_page(nativeCmd)];
@@ -3978,10 +4078,15 @@ class SkeletonDrawable {
   /// scaling or fitting.
   List<RenderCommand> renderToCanvas(Canvas canvas) {
     var commands = render();
+    drawToCanvas(canvas, commands);
+    return commands;
+  }
+
+  /// Draws render commands of this drawable, e.g. returned by [SkeletonDrawableBatch.updateAndRender], to the canvas.
+  void drawToCanvas(Canvas canvas, List<RenderCommand> commands) {
     for (final cmd in commands) {
       canvas.drawVertices(cmd.vertices, rendering.BlendMode.modulate, atlas.atlasPagePaints[cmd.atlasPageIndex][cmd.blendMode]!);
     }
-    return commands;
   }
 
   /// Renders the skeleton drawable's current pose to a [PictureRecorder] with the given [width] and [height].
@@ -4040,6 +4145,90 @@ class SkeletonDrawable {
   }
 }
 
+/// Updates and renders many [SkeletonDrawable] instances with a single native call, optionally on several native threads.
+/// This avoids the overhead of separate calls to [SkeletonDrawable.update] and [SkeletonDrawable.render] for each drawable
+/// on screens with many animated skeletons. The render commands of all drawables are allocated from arenas owned by the
+/// batch rather than by each drawable.
+///
+/// Animation state events are dispatched to listeners after all drawables have been updated and rendered, so changes made
+/// by listeners to an animation state take effect on the next update.
+///
+/// The batch must be disposed via the [dispose] method when no longer needed.
+class SkeletonDrawableBatch {
+  late final spine_skeleton_drawable_batch _batch;
+  Pointer<spine_skeleton_drawable> _drawables = nullptr;
+  Pointer<Float> _deltas = nullptr;
+  Pointer<spine_render_command> _commands = nullptr;
+  int _capacity = 0;
+  bool _disposed = false;
+
+  /// Creates a batch that processes drawables on [numThreads] threads, including the calling thread. Only a single thread
+  /// is used on the web.
+  SkeletonDrawableBatch([int numThreads = 1]) {
+    _batch = _bindings.spine_skeleton_drawable_batch_create(numThreads);
+  }
+
+  /// Updates each drawable by its delta in seconds, see [SkeletonDrawable.update], and renders it. Returns the render
+  /// commands of each drawable, see [SkeletonDrawable.render]. Disposed drawables are skipped and get no commands. A
+  /// drawable listed more than once is updated once, by its first delta.
+  List<List<RenderCommand>> updateAndRender(List<SkeletonDrawable> drawables, List<double> deltas) {
+    if (_disposed) return [];
+    _ensureCapacity(drawables.length);
+    int numDrawables = 0;
+    for (int i = 0; i < drawables.length; i++) {
+      if (drawables[i]._disposed) continue;
+      _drawables[numDrawables] = drawables[i]._drawable;
+      _deltas[numDrawables] = deltas[i];
+      numDrawables++;
+    }
+    _bindings.spine_skeleton_drawable_batch_update_and_render(_batch, _drawables, _deltas, numDrawables, _commands);
+
+    final List<List<RenderCommand>> result = [];
+    int nativeIndex = 0;
+    for (final drawable in drawables) {
+      if (drawable._disposed) {
+        result.add([]);
+        continue;
+      }
+      drawable.animationState._dispatchEvents();
+      // The native commands are the drawable's own, so they are cached as by SkeletonDrawable.render().
+      final generation = drawable.skeleton.getGeneration();
+      final nativeCmd = _commands[nativeIndex++];
+      if (drawable._renderCommands == null || generation != drawable._renderGeneration) {
+        drawable._renderCommands = drawable._toRenderCommands(nativeCmd);
+        drawable._renderGeneration = generation;
+      }
+      result.add(drawable._renderCommands!);
+    }
+    return result;
+  }
+
+  void _ensureCapacity(int capacity) {
+    if (capacity <= _capacity) return;
+    _freeBuffers();
+    _capacity = capacity;
+    // 8 bytes per pointer covers both native and wasm pointers.
+    _drawables = _allocator.allocate(8 * capacity).cast();
+    _deltas = _allocator.allocate(4 * capacity).cast();
+    _commands = _allocator.allocate(8 * capacity).cast();
+  }
+
+  void _freeBuffers() {
+    if (_capacity == 0) return;
+    _allocator.free(_drawables);
+    _allocator.free(_deltas);
+    _allocator.free(_commands);
+  }
+
+  /// Disposes the native resources of the batch. The drawables are not disposed.
+  void dispose() {
+    if (_disposed) return;
+    _disposed = true;
+    _freeBuffers();
+    _bindings.spine_skeleton_drawable_batch_dispose(_batch);
+  }
+}
+
 /// Stores the vertices, indices, and atlas page index to be used for rendering one or more attachments
 /// of a [Skeleton] to a [Canvas]. See the implementation of [SkeletonDrawable.renderToCanvas] on how to use this data to render it to a
 /// [Canvas].
@@ -1147,6 +1147,74 @@ class SpineFlutterBindings {
       _spine_skeleton_drawable_get_animation_state_eventsPtr.asFunction<
           spine_animation_state_events Function(spine_skeleton_drawable)>();
 
+  /// Updates and renders many drawables with a single call, optionally on several threads. Each drawable's animation state is
+  /// updated by its delta and applied, then its world transforms are updated and it is rendered. Commands are written to
+  /// commands[i] for drawables[i] and stay valid until the next call, they are allocated from arenas owned by the batch.
+  /// Animation state events are queued for each drawable as with spine_animation_state_update().
+  spine_skeleton_drawable_batch spine_skeleton_drawable_batch_create(
+    int numThreads,
+  ) {
+    return _spine_skeleton_drawable_batch_create(
+      numThreads,
+    );
+  }
+
+  late final _spine_skeleton_drawable_batch_createPtr = _lookup<
+          ffi.NativeFunction<spine_skeleton_drawable_batch Function(ffi.Int32)>>(
+      'spine_skeleton_drawable_batch_create');
+  late final _spine_skeleton_drawable_batch_create =
+      _spine_skeleton_drawable_batch_createPtr
+          .asFunction<spine_skeleton_drawable_batch Function(int)>();
+
+  void spine_skeleton_drawable_batch_update_and_render(
+    spine_skeleton_drawable_batch batch,
+    ffi.Pointer<spine_skeleton_drawable> drawables,
+    ffi.Pointer<ffi.Float> deltas,
+    int numDrawables,
+    ffi.Pointer<spine_render_command> commands,
+  ) {
+    return _spine_skeleton_drawable_batch_update_and_render(
+      batch,
+      drawables,
+      deltas,
+      numDrawables,
+      commands,
+    );
+  }
+
+  late final _spine_skeleton_drawable_batch_update_and_renderPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Void Function(
+                  spine_skeleton_drawable_batch,
+                  ffi.Pointer<spine_skeleton_drawable>,
+                  ffi.Pointer<ffi.Float>,
+                  ffi.Int32,
+                  ffi.Pointer<spine_render_command>)>>(
+      'spine_skeleton_drawable_batch_update_and_render');
+  late final _spine_skeleton_drawable_batch_update_and_render =
+      _spine_skeleton_drawable_batch_update_and_renderPtr.asFunction<
+          void Function(
+              spine_skeleton_drawable_batch,
+              ffi.Pointer<spine_skeleton_drawable>,
+              ffi.Pointer<ffi.Float>,
+              int,
+              ffi.Pointer<spine_render_command>)>();
+
+  void spine_skeleton_drawable_batch_dispose(
+    spine_skeleton_drawable_batch batch,
+  ) {
+    return _spine_skeleton_drawable_batch_dispose(
+      batch,
+    );
+  }
+
+  late final _spine_skeleton_drawable_batch_disposePtr = _lookup<
+          ffi.NativeFunction<ffi.Void Function(spine_skeleton_drawable_batch)>>(
+      'spine_skeleton_drawable_batch_dispose');
+  late final _spine_skeleton_drawable_batch_dispose =
+      _spine_skeleton_drawable_batch_disposePtr
+          .asFunction<void Function(spine_skeleton_drawable_batch)>();
+
   ffi.Pointer<ffi.Float> spine_render_command_get_positions(
     spine_render_command command,
   ) {
@@ -3314,6 +3382,109 @@ class SpineFlutterBindings {
   late final _spine_skeleton_set_scale_y = _spine_skeleton_set_scale_yPtr
       .asFunction<void Function(spine_skeleton, double)>();
 
+  int spine_skeleton_get_generation(
+    spine_skeleton skeleton,
+  ) {
+    return _spine_skeleton_get_generation(
+      skeleton,
+    );
+  }
+
+  late final _spine_skeleton_get_generationPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(spine_skeleton)>>(
+          'spine_skeleton_get_generation');
+  late final _spine_skeleton_get_generation = _spine_skeleton_get_generationPtr
+      .asFunction<int Function(spine_skeleton)>();
+
+  void spine_skeleton_mark_changed(
+    spine_skeleton skeleton,
+  ) {
+    return _spine_skeleton_mark_changed(
+      skeleton,
+    );
+  }
+
+  late final _spine_skeleton_mark_changedPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(spine_skeleton)>>(
+          'spine_skeleton_mark_changed');
+  late final _spine_skeleton_mark_changed = _spine_skeleton_mark_changedPtr
+      .asFunction<void Function(spine_skeleton)>();
+
+  /// Bulk accessors, to read or write many bones or slots with a single call. The indices select bones or slots by their
+  /// index in the skeleton, if null the first num bones or slots are used. Each returns the number of bones or slots read or
+  /// written, or -1 without writing anything if an index is out of range.
+  /// Writes 6 floats per bone: a, b, c, d, worldX, worldY.
+  int spine_skeleton_get_bone_world_transforms(
+    spine_skeleton skeleton,
+    ffi.Pointer<ffi.Int32> boneIndices,
+    int numBones,
+    ffi.Pointer<ffi.Float> transforms,
+  ) {
+    return _spine_skeleton_get_bone_world_transforms(
+      skeleton,
+      boneIndices,
+      numBones,
+      transforms,
+    );
+  }
+
+  late final _spine_skeleton_get_bone_world_transformsPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int32 Function(spine_skeleton, ffi.Pointer<ffi.Int32>, ffi.Int32,
+              ffi.Pointer<ffi.Float>)>>('spine_skeleton_get_bone_world_transforms');
+  late final _spine_skeleton_get_bone_world_transforms =
+      _spine_skeleton_get_bone_world_transformsPtr.asFunction<
+          int Function(spine_skeleton, ffi.Pointer<ffi.Int32>, int,
+              ffi.Pointer<ffi.Float>)>();
+
+  /// Writes 4 floats per slot: r, g, b, a.
+  int spine_skeleton_get_slot_colors(
+    spine_skeleton skeleton,
+    ffi.Pointer<ffi.Int32> slotIndices,
+    int numSlots,
+    ffi.Pointer<ffi.Float> colors,
+  ) {
+    return _spine_skeleton_get_slot_colors(
+      skeleton,
+      slotIndices,
+      numSlots,
+      colors,
+    );
+  }
+
+  late final _spine_skeleton_get_slot_colorsPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int32 Function(spine_skeleton, ffi.Pointer<ffi.Int32>, ffi.Int32,
+              ffi.Pointer<ffi.Float>)>>('spine_skeleton_get_slot_colors');
+  late final _spine_skeleton_get_slot_colors =
+      _spine_skeleton_get_slot_colorsPtr.asFunction<
+          int Function(spine_skeleton, ffi.Pointer<ffi.Int32>, int,
+              ffi.Pointer<ffi.Float>)>();
+
+  /// Reads 7 floats per bone: x, y, rotation, scaleX, scaleY, shearX, shearY.
+  int spine_skeleton_set_bone_local_transforms(
+    spine_skeleton skeleton,
+    ffi.Pointer<ffi.Int32> boneIndices,
+    int numBones,
+    ffi.Pointer<ffi.Float> transforms,
+  ) {
+    return _spine_skeleton_set_bone_local_transforms(
+      skeleton,
+      boneIndices,
+      numBones,
+      transforms,
+    );
+  }
+
+  late final _spine_skeleton_set_bone_local_transformsPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int32 Function(spine_skeleton, ffi.Pointer<ffi.Int32>, ffi.Int32,
+              ffi.Pointer<ffi.Float>)>>('spine_skeleton_set_bone_local_transforms');
+  late final _spine_skeleton_set_bone_local_transforms =
+      _spine_skeleton_set_bone_local_transformsPtr.asFunction<
+          int Function(spine_skeleton, ffi.Pointer<ffi.Int32>, int,
+              ffi.Pointer<ffi.Float>)>();
+
   ffi.Pointer<utf8> spine_event_data_get_name(
     spine_event_data event,
   ) {
@@ -10057,6 +10228,8 @@ class spine_vector_wrapper extends ffi.Opaque {}
 
 class spine_skeleton_drawable_wrapper extends ffi.Opaque {}
 
+class spine_skeleton_drawable_batch_wrapper extends ffi.Opaque {}
+
 class spine_skin_entry_wrapper extends ffi.Opaque {}
 
 class spine_skin_entries_wrapper extends ffi.Opaque {}
@@ -10145,6 +10318,8 @@ typedef spine_transform_constraint_data
 typedef spine_path_constraint_data
     = ffi.Pointer<spine_path_constraint_data_wrapper>;
 typedef spine_skeleton_drawable = ffi.Pointer<spine_skeleton_drawable_wrapper>;
+typedef spine_skeleton_drawable_batch
+    = ffi.Pointer<spine_skeleton_drawable_batch_wrapper>;
 typedef spine_render_command = ffi.Pointer<spine_render_command_wrapper>;
 typedef spine_skeleton = ffi.Pointer<spine_skeleton_wrapper>;
 typedef spine_animation_state = ffi.Pointer<spine_animation_state_wrapper>;
@@ -32,6 +32,14 @@
 #include <spine/Version.h>
 #include <spine/Debug.h>
 
+#ifndef __EMSCRIPTEN__
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
 using namespace spine;
 
 struct Block {
@@ -160,8 +168,13 @@ typedef struct _spine_skeleton_drawable : public SpineObject {
 	Vector<float> worldVertices;
 	Vector<unsigned short> quadIndices;
 	Vector<_spine_render_command *> renderCommands;
+	_spine_render_command *renderCommand;
+	size_t renderGeneration;
+	bool rendered;
+	// Index of the drawable's first entry in the batch being processed, or -1.
+	int32_t batchIndex;
 
-	_spine_skeleton_drawable() {
+	_spine_skeleton_drawable() : renderCommand(nullptr), renderGeneration(0), rendered(false), batchIndex(-1) {
 		quadIndices.add(0);
 		quadIndices.add(1);
 		quadIndices.add(2);
@@ -171,6 +184,33 @@ typedef struct _spine_skeleton_drawable : public SpineObject {
 	}
 } _spine_skeleton_drawable;
 
+typedef struct _spine_skeleton_drawable_batch : public SpineObject {
+	_spine_skeleton_drawable **drawables;
+	float *deltas;
+	spine_render_command *commands;
+	// Indices of the first entry of each distinct drawable.
+	Vector<int32_t> indices;
+#ifndef __EMSCRIPTEN__
+	std::atomic<int32_t> nextDrawable;
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable started;
+	std::condition_variable finished;
+	int32_t job;
+	int32_t numBusy;
+	bool exit;
+#else
+	int32_t nextDrawable;
+#endif
+
+	_spine_skeleton_drawable_batch() : drawables(nullptr), deltas(nullptr), commands(nullptr), nextDrawable(0)
+#ifndef __EMSCRIPTEN__
+		, job(0), numBusy(0), exit(false)
+#endif
+	{
+	}
+} _spine_skeleton_drawable_batch;
+
 typedef struct _spine_skin_entry {
 	int32_t slotIndex;
 	utf8 *name;
@@ -718,16 +758,11 @@ static _spine_render_command *batch_commands(BlockAllocator &allocator, Vector<_
 	return root;
 }
 
-spine_render_command spine_skeleton_drawable_render(spine_skeleton_drawable drawable) {
-	_spine_skeleton_drawable *_drawable = (_spine_skeleton_drawable *) drawable;
-	if (!_drawable) return nullptr;
-	if (!_drawable->skeleton) return nullptr;
-
-	_drawable->allocator->compress();
+static _spine_render_command *render_drawable(_spine_skeleton_drawable *_drawable, BlockAllocator &allocator) {
+	Skeleton *skeleton = (Skeleton *) _drawable->skeleton;
 	_drawable->renderCommands.clear();
 
 	SkeletonClipping &clipper = *(SkeletonClipping *) _drawable->clipping;
-	Skeleton *skeleton = (Skeleton *) _drawable->skeleton;
 
 	for (unsigned i = 0; i < skeleton->getSlots().size(); ++i) {
 		Slot &slot = *skeleton->getDrawOrder()[i];
@@ -808,7 +843,7 @@ spine_render_command spine_skeleton_drawable_render(spine_skeleton_drawable draw
 			indicesCount = (int32_t) (clipper.getClippedTriangles().size());
 		}
 
-		_spine_render_command *cmd = spine_render_command_create(*_drawable->allocator, verticesCount, indicesCount, (spine_blend_mode) slot.getData().getBlendMode(), pageIndex);
+		_spine_render_command *cmd = spine_render_command_create(allocator, verticesCount, indicesCount, (spine_blend_mode) slot.getData().getBlendMode(), pageIndex);
 		_drawable->renderCommands.add(cmd);
 		memcpy(cmd->positions, vertices->buffer(), (verticesCount << 1) * sizeof(float));
 		memcpy(cmd->uvs, uvs->buffer(), (verticesCount << 1) * sizeof(float));
@@ -818,7 +853,24 @@ spine_render_command spine_skeleton_drawable_render(spine_skeleton_drawable draw
 	}
 	clipper.clipEnd();
 
-	return (spine_render_command) batch_commands(*_drawable->allocator, _drawable->renderCommands);
+	return batch_commands(allocator, _drawable->renderCommands);
+}
+
+spine_render_command spine_skeleton_drawable_render(spine_skeleton_drawable drawable) {
+	_spine_skeleton_drawable *_drawable = (_spine_skeleton_drawable *) drawable;
+	if (!_drawable) return nullptr;
+	if (!_drawable->skeleton) return nullptr;
+
+	// Reuse the previous commands if nothing affecting the output changed.
+	Skeleton *skeleton = (Skeleton *) _drawable->skeleton;
+	size_t generation = skeleton->getGeneration();
+	if (_drawable->rendered && _drawable->renderGeneration == generation) return (spine_render_command) _drawable->renderCommand;
+
+	_drawable->allocator->compress();
+	_drawable->renderCommand = render_drawable(_drawable, *_drawable->allocator);
+	_drawable->renderGeneration = generation;
+	_drawable->rendered = true;
+	return (spine_render_command) _drawable->renderCommand;
 }
 
 spine_skeleton spine_skeleton_drawable_get_skeleton(spine_skeleton_drawable drawable) {
@@ -841,6 +893,122 @@ spine_animation_state_events spine_skeleton_drawable_get_animation_state_events(
 	return ((_spine_skeleton_drawable *) drawable)->animationStateEvents;
 }
 
+// SkeletonDrawableBatch
+
+static void update_drawable(_spine_skeleton_drawable *drawable, float delta) {
+	Skeleton *skeleton = (Skeleton *) drawable->skeleton;
+	AnimationState *state = (AnimationState *) drawable->animationState;
+	state->update(delta);
+	state->apply(*skeleton);
+	skeleton->updateWorldTransform();
+}
+
+static void process_drawables(_spine_skeleton_drawable_batch *batch) {
+	int32_t numDrawables = (int32_t) batch->indices.size();
+	while (true) {
+		int32_t next = batch->nextDrawable++;
+		if (next >= numDrawables) break;
+		int32_t i = batch->indices[next];
+		_spine_skeleton_drawable *drawable = batch->drawables[i];
+		update_drawable(drawable, batch->deltas[i]);
+		// Each drawable is processed by one thread, so it can render into its own allocator. The previous commands are
+		// reused if the skeleton's generation did not change.
+		batch->commands[i] = spine_skeleton_drawable_render((spine_skeleton_drawable) drawable);
+	}
+}
+
+#ifndef __EMSCRIPTEN__
+static void run_worker(_spine_skeleton_drawable_batch *batch) {
+	int32_t job = 0;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(batch->mutex);
+			batch->started.wait(lock, [&] { return batch->exit || batch->job != job; });
+			if (batch->exit) return;
+			job = batch->job;
+		}
+		process_drawables(batch);
+		{
+			std::lock_guard<std::mutex> lock(batch->mutex);
+			if (--batch->numBusy == 0) batch->finished.notify_one();
+		}
+	}
+}
+#endif
+
+spine_skeleton_drawable_batch spine_skeleton_drawable_batch_create(int32_t numThreads) {
+	_spine_skeleton_drawable_batch *batch = new (__FILE__, __LINE__) _spine_skeleton_drawable_batch();
+#ifdef __EMSCRIPTEN__
+	numThreads = 1;
+#endif
+	if (numThreads < 1) numThreads = 1;
+#ifndef __EMSCRIPTEN__
+	// The calling thread processes drawables too.
+	for (int32_t i = 1; i < numThreads; i++)
+		batch->workers.push_back(std::thread(run_worker, batch));
+#endif
+	return (spine_skeleton_drawable_batch) batch;
+}
+
+void spine_skeleton_drawable_batch_update_and_render(spine_skeleton_drawable_batch batch, spine_skeleton_drawable *drawables, float *deltas, int32_t numDrawables, spine_render_command *commands) {
+	_spine_skeleton_drawable_batch *_batch = (_spine_skeleton_drawable_batch *) batch;
+	if (!_batch || !drawables || !deltas || !commands) return;
+	_batch->drawables = (_spine_skeleton_drawable **) drawables;
+	_batch->deltas = deltas;
+	_batch->commands = commands;
+	_batch->nextDrawable = 0;
+
+	// A drawable listed more than once is processed once, so no two threads update or render it at the same time.
+	_batch->indices.clear();
+	for (int32_t i = 0; i < numDrawables; i++) {
+		_spine_skeleton_drawable *drawable = _batch->drawables[i];
+		if (drawable->batchIndex != -1) continue;
+		drawable->batchIndex = i;
+		_batch->indices.add(i);
+	}
+#ifndef __EMSCRIPTEN__
+	// The debug extension is not thread safe.
+	bool parallel = !_batch->workers.empty() && _batch->indices.size() > 1 && SpineExtension::getInstance() != debugExtension;
+	if (parallel) {
+		{
+			std::lock_guard<std::mutex> lock(_batch->mutex);
+			_batch->numBusy = (int32_t) _batch->workers.size();
+			_batch->job++;
+		}
+		_batch->started.notify_all();
+	}
+#endif
+	process_drawables(_batch);
+#ifndef __EMSCRIPTEN__
+	if (parallel) {
+		std::unique_lock<std::mutex> lock(_batch->mutex);
+		_batch->finished.wait(lock, [&] { return _batch->numBusy == 0; });
+	}
+#endif
+
+	for (int32_t i = 0; i < numDrawables; i++) {
+		int32_t first = _batch->drawables[i]->batchIndex;
+		if (first != i) commands[i] = commands[first];
+	}
+	for (int32_t i = 0; i < numDrawables; i++)
+		_batch->drawables[i]->batchIndex = -1;
+}
+
+void spine_skeleton_drawable_batch_dispose(spine_skeleton_drawable_batch batch) {
+	_spine_skeleton_drawable_batch *_batch = (_spine_skeleton_drawable_batch *) batch;
+	if (!_batch) return;
+#ifndef __EMSCRIPTEN__
+	{
+		std::lock_guard<std::mutex> lock(_batch->mutex);
+		_batch->exit = true;
+	}
+	_batch->started.notify_all();
+	for (size_t i = 0; i < _batch->workers.size(); i++)
+		_batch->workers[i].join();
+#endif
+	delete _batch;
+}
+
 // Render command
 float *spine_render_command_get_positions(spine_render_command command) {
 	if (!command) return nullptr;
@@ -1638,6 +1806,76 @@ void spine_skeleton_set_scale_y(spine_skeleton skeleton, float scaleY) {
 	_skeleton->setScaleY(scaleY);
 }
 
+int32_t spine_skeleton_get_generation(spine_skeleton skeleton) {
+	if (skeleton == nullptr) return 0;
+	Skeleton *_skeleton = (Skeleton *) skeleton;
+	return (int32_t) _skeleton->getGeneration();
+}
+
+void spine_skeleton_mark_changed(spine_skeleton skeleton) {
+	if (skeleton == nullptr) return;
+	Skeleton *_skeleton = (Skeleton *) skeleton;
+	_skeleton->markChanged();
+}
+
+static bool check_indices(const int32_t *indices, int32_t num, size_t size) {
+	if (num < 0) return false;
+	if (indices == nullptr) return (size_t) num <= size;
+	for (int32_t i = 0; i < num; i++)
+		if (indices[i] < 0 || (size_t) indices[i] >= size) return false;
+	return true;
+}
+
+int32_t spine_skeleton_get_bone_world_transforms(spine_skeleton skeleton, const int32_t *boneIndices, int32_t numBones, float *transforms) {
+	if (skeleton == nullptr || transforms == nullptr) return -1;
+	Skeleton *_skeleton = (Skeleton *) skeleton;
+	Vector<Bone *> &bones = _skeleton->getBones();
+	if (!check_indices(boneIndices, numBones, bones.size())) return -1;
+	for (int32_t i = 0; i < numBones; i++, transforms += 6) {
+		Bone *bone = bones[boneIndices ? boneIndices[i] : i];
+		transforms[0] = bone->getA();
+		transforms[1] = bone->getB();
+		transforms[2] = bone->getC();
+		transforms[3] = bone->getD();
+		transforms[4] = bone->getWorldX();
+		transforms[5] = bone->getWorldY();
+	}
+	return numBones;
+}
+
+int32_t spine_skeleton_get_slot_colors(spine_skeleton skeleton, const int32_t *slotIndices, int32_t numSlots, float *colors) {
+	if (skeleton == nullptr || colors == nullptr) return -1;
+	Skeleton *_skeleton = (Skeleton *) skeleton;
+	Vector<Slot *> &slots = _skeleton->getSlots();
+	if (!check_indices(slotIndices, numSlots, slots.size())) return -1;
+	for (int32_t i = 0; i < numSlots; i++, colors += 4) {
+		Color &color = slots[slotIndices ? slotIndices[i] : i]->getColor();
+		colors[0] = color.r;
+		colors[1] = color.g;
+		colors[2] = color.b;
+		colors[3] = color.a;
+	}
+	return numSlots;
+}
+
+int32_t spine_skeleton_set_bone_local_transforms(spine_skeleton skeleton, const int32_t *boneIndices, int32_t numBones, const float *transforms) {
+	if (skeleton == nullptr || transforms == nullptr) return -1;
+	Skeleton *_skeleton = (Skeleton *) skeleton;
+	Vector<Bone *> &bones = _skeleton->getBones();
+	if (!check_indices(boneIndices, numBones, bones.size())) return -1;
+	for (int32_t i = 0; i < numBones; i++, transforms += 7) {
+		Bone *bone = bones[boneIndices ? boneIndices[i] : i];
+		bone->setX(transforms[0]);
+		bone->setY(transforms[1]);
+		bone->setRotation(transforms[2]);
+		bone->setScaleX(transforms[3]);
+		bone->setScaleY(transforms[4]);
+		bone->setShearX(transforms[5]);
+		bone->setShearY(transforms[6]);
+	}
+	return numBones;
+}
+
 // EventData
 
 const utf8 *spine_event_data_get_name(spine_event_data event) {
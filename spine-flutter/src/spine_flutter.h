@@ -98,6 +98,7 @@ SPINE_OPAQUE_TYPE(spine_bounds)
 SPINE_OPAQUE_TYPE(spine_color)
 SPINE_OPAQUE_TYPE(spine_vector)
 SPINE_OPAQUE_TYPE(spine_skeleton_drawable)
+SPINE_OPAQUE_TYPE(spine_skeleton_drawable_batch)
 SPINE_OPAQUE_TYPE(spine_skin_entry)
 SPINE_OPAQUE_TYPE(spine_skin_entries)
 
@@ -252,6 +253,16 @@ SPINE_FLUTTER_EXPORT spine_animation_state spine_skeleton_drawable_get_animation
 SPINE_FLUTTER_EXPORT spine_animation_state_data spine_skeleton_drawable_get_animation_state_data(spine_skeleton_drawable drawable);
 SPINE_FLUTTER_EXPORT spine_animation_state_events spine_skeleton_drawable_get_animation_state_events(spine_skeleton_drawable drawable);
 
+// Updates and renders many drawables with a single call, optionally on several threads. Each drawable's animation state is
+// updated by its delta and applied, then its world transforms are updated and it is rendered. Commands are written to
+// commands[i] for drawables[i] and are the same as spine_skeleton_drawable_render() returns: they are owned by the drawable
+// and reused while the skeleton's generation doesn't change. A drawable listed more than once is updated and rendered
+// once, with the delta of its first entry, and all its entries receive the same commands. Animation state events are
+// queued for each drawable as with spine_animation_state_update().
+SPINE_FLUTTER_EXPORT spine_skeleton_drawable_batch spine_skeleton_drawable_batch_create(int32_t numThreads);
+SPINE_FLUTTER_EXPORT void spine_skeleton_drawable_batch_update_and_render(spine_skeleton_drawable_batch batch, spine_skeleton_drawable *drawables, float *deltas, int32_t numDrawables, spine_render_command *commands);
+SPINE_FLUTTER_EXPORT void spine_skeleton_drawable_batch_dispose(spine_skeleton_drawable_batch batch);
+
 SPINE_FLUTTER_EXPORT float *spine_render_command_get_positions(spine_render_command command);
 SPINE_FLUTTER_EXPORT float *spine_render_command_get_uvs(spine_render_command command);
 SPINE_FLUTTER_EXPORT int32_t *spine_render_command_get_colors(spine_render_command command);
@@ -401,6 +412,17 @@ SPINE_FLUTTER_EXPORT float spine_skeleton_get_scale_x(spine_skeleton skeleton);
 SPINE_FLUTTER_EXPORT void spine_skeleton_set_scale_x(spine_skeleton skeleton, float scaleX);
 SPINE_FLUTTER_EXPORT float spine_skeleton_get_scale_y(spine_skeleton skeleton);
 SPINE_FLUTTER_EXPORT void spine_skeleton_set_scale_y(spine_skeleton skeleton, float scaleY);
+SPINE_FLUTTER_EXPORT int32_t spine_skeleton_get_generation(spine_skeleton skeleton);
+SPINE_FLUTTER_EXPORT void spine_skeleton_mark_changed(spine_skeleton skeleton);
+// Bulk accessors, to read or write many bones or slots with a single call. The indices select bones or slots by their
+// index in the skeleton, if null the first num bones or slots are used. Each returns the number of bones or slots read or
+// written, or -1 without writing anything if an index is out of range.
+// Writes 6 floats per bone: a, b, c, d, worldX, worldY.
+SPINE_FLUTTER_EXPORT int32_t spine_skeleton_get_bone_world_transforms(spine_skeleton skeleton, const int32_t *boneIndices, int32_t numBones, float *transforms);
+// Writes 4 floats per slot: r, g, b, a.
+SPINE_FLUTTER_EXPORT int32_t spine_skeleton_get_slot_colors(spine_skeleton skeleton, const int32_t *slotIndices, int32_t numSlots, float *colors);
+// Reads 7 floats per bone: x, y, rotation, scaleX, scaleY, shearX, shearY.
+SPINE_FLUTTER_EXPORT int32_t spine_skeleton_set_bone_local_transforms(spine_skeleton skeleton, const int32_t *boneIndices, int32_t numBones, const float *transforms);
 
 SPINE_FLUTTER_EXPORT const utf8 *spine_event_data_get_name(spine_event_data event);
 SPINE_FLUTTER_EXPORT int32_t spine_event_data_get_int_value(spine_event_data event);
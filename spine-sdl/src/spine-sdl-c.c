@@ -182,8 +182,125 @@ void spSkeletonDrawable_draw(spSkeletonDrawable *self, struct SDL_Renderer *rend
 	spSkeletonClipping_clipEnd2(clipper);
 }
 
+typedef struct {
+	SDL_Texture *texture;
+	char *path;
+	stbi_uc *data;
+	int width;
+	int /*boolean*/ decoded;
+} _spSdlImage;
+
+/* Decodes page images on worker threads, in the order the pages were loaded. */
+typedef struct {
+	SDL_mutex *mutex;
+	SDL_cond *queued, *decoded;
+	SDL_Thread **threads;
+	int numThreads;
+	_spSdlImage *images;
+	int numImages, imagesCapacity, nextImage;
+	int /*boolean*/ exit;
+} _spSdlDecoder;
+
+static _spSdlDecoder *decoder = NULL;
+
+static int _spSdlDecoder_work(void *data) {
+	_spSdlDecoder *self = (_spSdlDecoder *) data;
+	while (-1) {
+		SDL_LockMutex(self->mutex);
+		while (!self->exit && self->nextImage == self->numImages)
+			SDL_CondWait(self->queued, self->mutex);
+		if (self->nextImage == self->numImages) {
+			SDL_UnlockMutex(self->mutex);
+			return 0;
+		}
+		int index = self->nextImage++;
+		const char *path = self->images[index].path;
+		SDL_UnlockMutex(self->mutex);
+
+		int width, height, components;
+		stbi_uc *imageData = stbi_load(path, &width, &height, &components, 4);
+
+		SDL_LockMutex(self->mutex);
+		self->images[index].data = imageData;
+		self->images[index].width = width;
+		self->images[index].decoded = -1;
+		SDL_CondBroadcast(self->decoded);
+		SDL_UnlockMutex(self->mutex);
+	}
+}
+
+void spSdl_beginTextureLoading(int numThreads) {
+	if (decoder) return;
+	if (numThreads < 1) numThreads = 1;
+	decoder = NEW(_spSdlDecoder);
+	decoder->mutex = SDL_CreateMutex();
+	decoder->queued = SDL_CreateCond();
+	decoder->decoded = SDL_CreateCond();
+	decoder->threads = MALLOC(SDL_Thread *, numThreads);
+	decoder->numThreads = numThreads;
+	for (int i = 0; i < numThreads; i++)
+		decoder->threads[i] = SDL_CreateThread(_spSdlDecoder_work, "spine-sdl decoder", decoder);
+}
+
+void spSdl_finishTextureLoading(void) {
+	if (!decoder) return;
+	/* Upload each image as soon as it is decoded. */
+	SDL_LockMutex(decoder->mutex);
+	for (int i = 0; i < decoder->numImages; i++) {
+		while (!decoder->images[i].decoded)
+			SDL_CondWait(decoder->decoded, decoder->mutex);
+		_spSdlImage image = decoder->images[i];
+		SDL_UnlockMutex(decoder->mutex);
+		if (image.data) {
+			if (image.texture) SDL_UpdateTexture(image.texture, NULL, image.data, image.width * 4);
+			stbi_image_free(image.data);
+		}
+		FREE(image.path);
+		SDL_LockMutex(decoder->mutex);
+	}
+	decoder->exit = -1;
+	SDL_CondBroadcast(decoder->queued);
+	SDL_UnlockMutex(decoder->mutex);
+	for (int i = 0; i < decoder->numThreads; i++)
+		SDL_WaitThread(decoder->threads[i], NULL);
+
+	FREE(decoder->threads);
+	FREE(decoder->images);
+	SDL_DestroyCond(decoder->decoded);
+	SDL_DestroyCond(decoder->queued);
+	SDL_DestroyMutex(decoder->mutex);
+	FREE(decoder);
+	decoder = NULL;
+}
+
+static void _spSdlDecoder_add(SDL_Texture *texture, const char *path) {
+	SDL_LockMutex(decoder->mutex);
+	if (decoder->numImages == decoder->imagesCapacity) {
+		decoder->imagesCapacity = decoder->imagesCapacity ? decoder->imagesCapacity * 2 : 16;
+		decoder->images = REALLOC(decoder->images, _spSdlImage, decoder->imagesCapacity);
+	}
+	_spSdlImage *image = &decoder->images[decoder->numImages++];
+	image->texture = texture;
+	MALLOC_STR(image->path, path);
+	image->data = NULL;
+	image->width = 0;
+	image->decoded = 0;
+	SDL_CondSignal(decoder->queued);
+	SDL_UnlockMutex(decoder->mutex);
+}
+
 void _spAtlasPage_createTexture(spAtlasPage *self, const char *path) {
 	int width, height, components;
+	if (decoder) {
+		/* Only the image header is read here, the texture is filled by spSdl_finishTextureLoading(). */
+		if (!stbi_info(path, &width, &height, &components)) return;
+		SDL_Texture *texture = SDL_CreateTexture((SDL_Renderer *) self->atlas->rendererObject, SDL_PIXELFORMAT_ABGR8888,
+												 SDL_TEXTUREACCESS_STATIC, width, height);
+		if (!texture) return;
+		_spSdlDecoder_add(texture, path);
+		self->rendererObject = texture;
+		return;
+	}
 	stbi_uc *imageData = stbi_load(path, &width, &height, &components, 4);
 	if (!imageData) return;
 	SDL_Texture *texture = SDL_CreateTexture((SDL_Renderer *) self->atlas->rendererObject, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, width,
@@ -202,6 +319,13 @@ void _spAtlasPage_createTexture(spAtlasPage *self, const char *path) {
 }
 
 void _spAtlasPage_disposeTexture(spAtlasPage *self) {
+	if (decoder) {
+		/* Don't upload to a texture destroyed before spSdl_finishTextureLoading(). */
+		SDL_LockMutex(decoder->mutex);
+		for (int i = 0; i < decoder->numImages; i++)
+			if (decoder->images[i].texture == self->rendererObject) decoder->images[i].texture = NULL;
+		SDL_UnlockMutex(decoder->mutex);
+	}
 	SDL_DestroyTexture((SDL_Texture *) self->rendererObject);
 }
 
@@ -58,6 +58,15 @@ SP_API void spSkeletonDrawable_update(spSkeletonDrawable *self, float delta);
 
 SP_API void spSkeletonDrawable_draw(spSkeletonDrawable *self, struct SDL_Renderer *renderer);
 
+/* Atlas pages loaded until spSdl_finishTextureLoading() is called get their texture created right away, but their images
+ * are decoded on numThreads worker threads. Decoding overlaps with parsing the atlas and any skeleton data loaded in
+ * between. */
+SP_API void spSdl_beginTextureLoading(int numThreads);
+
+/* Waits for the images of the pages loaded since spSdl_beginTextureLoading() and uploads them to their textures. Must be
+ * called on the render thread before the textures are drawn. */
+SP_API void spSdl_finishTextureLoading(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,10 @@
 
 #include "spine-sdl-cpp.h"
 #include <SDL.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #define STB_IMAGE_IMPLEMENTATION
 
@@ -36,7 +40,9 @@
 
 using namespace spine;
 
-SkeletonDrawable::SkeletonDrawable(SkeletonData *skeletonData, AnimationStateData *animationStateData) {
+SkeletonDrawable::SkeletonDrawable(SkeletonData *skeletonData, AnimationStateData *animationStateData)
+	: skeletonRenderer(VertexFormat(sizeof(SDL_Vertex), offsetof(SDL_Vertex, position), offsetof(SDL_Vertex, tex_coord),
+									offsetof(SDL_Vertex, color))) {
 	Bone::setYDown(true);
 	skeleton = new (__FILE__, __LINE__) Skeleton(skeletonData);
 
@@ -58,107 +64,14 @@ void SkeletonDrawable::update(float delta) {
 }
 
 void SkeletonDrawable::draw(SDL_Renderer *renderer) {
-	Vector<unsigned short> quadIndices;
-	quadIndices.add(0);
-	quadIndices.add(1);
-	quadIndices.add(2);
-	quadIndices.add(2);
-	quadIndices.add(3);
-	quadIndices.add(0);
-	SDL_Texture *texture;
-	SDL_Vertex sdlVertex;
-	for (unsigned i = 0; i < skeleton->getSlots().size(); ++i) {
-		Slot &slot = *skeleton->getDrawOrder()[i];
-		Attachment *attachment = slot.getAttachment();
-		if (!attachment) continue;
-
-		// Early out if the slot color is 0 or the bone is not active
-		if (slot.getColor().a == 0 || !slot.getBone().isActive()) {
-			clipper.clipEnd(slot);
-			continue;
-		}
-
-		Vector<float> *vertices = &worldVertices;
-		int verticesCount = 0;
-		Vector<float> *uvs = NULL;
-		Vector<unsigned short> *indices;
-		int indicesCount = 0;
-		Color *attachmentColor;
-
-		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
-			RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
-			attachmentColor = &regionAttachment->getColor();
-
-			// Early out if the slot color is 0
-			if (attachmentColor->a == 0) {
-				clipper.clipEnd(slot);
-				continue;
-			}
-
-			worldVertices.setSize(8, 0);
-			regionAttachment->computeWorldVertices(slot, worldVertices, 0, 2);
-			verticesCount = 4;
-			uvs = &regionAttachment->getUVs();
-			indices = &quadIndices;
-			indicesCount = 6;
-			texture = (SDL_Texture *) regionAttachment->getRegion()->rendererObject;
-
-		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
-			MeshAttachment *mesh = (MeshAttachment *) attachment;
-			attachmentColor = &mesh->getColor();
-
-			// Early out if the slot color is 0
-			if (attachmentColor->a == 0) {
-				clipper.clipEnd(slot);
-				continue;
-			}
-
-			worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
-			mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices.buffer(), 0, 2);
-			texture = (SDL_Texture *) mesh->getRegion()->rendererObject;
-			verticesCount = mesh->getWorldVerticesLength() >> 1;
-			uvs = &mesh->getUVs();
-			indices = &mesh->getTriangles();
-			indicesCount = indices->size();
-
-		} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
-			ClippingAttachment *clip = (ClippingAttachment *) slot.getAttachment();
-			clipper.clipStart(slot, clip);
-			continue;
-		} else
-			continue;
-
-		Uint8 r = static_cast<Uint8>(skeleton->getColor().r * slot.getColor().r * attachmentColor->r * 255);
-		Uint8 g = static_cast<Uint8>(skeleton->getColor().g * slot.getColor().g * attachmentColor->g * 255);
-		Uint8 b = static_cast<Uint8>(skeleton->getColor().b * slot.getColor().b * attachmentColor->b * 255);
-		Uint8 a = static_cast<Uint8>(skeleton->getColor().a * slot.getColor().a * attachmentColor->a * 255);
-		sdlVertex.color.r = r;
-		sdlVertex.color.g = g;
-		sdlVertex.color.b = b;
-		sdlVertex.color.a = a;
-
-		if (clipper.isClipping()) {
-			clipper.clipTriangles(worldVertices, *indices, *uvs, 2);
-			vertices = &clipper.getClippedVertices();
-			verticesCount = clipper.getClippedVertices().size() >> 1;
-			uvs = &clipper.getClippedUVs();
-			indices = &clipper.getClippedTriangles();
-			indicesCount = clipper.getClippedTriangles().size();
-		}
-
-		sdlVertices.clear();
-		for (int ii = 0; ii < verticesCount << 1; ii += 2) {
-			sdlVertex.position.x = (*vertices)[ii];
-			sdlVertex.position.y = (*vertices)[ii + 1];
-			sdlVertex.tex_coord.x = (*uvs)[ii];
-			sdlVertex.tex_coord.y = (*uvs)[ii + 1];
-			sdlVertices.add(sdlVertex);
-		}
-		sdlIndices.clear();
-		for (int ii = 0; ii < (int) indices->size(); ii++)
-			sdlIndices.add((*indices)[ii]);
-
-		switch (slot.getData().getBlendMode()) {
+	skeletonRenderer.render(*skeleton);
+	SDL_Vertex *vertices = (SDL_Vertex *) skeletonRenderer.getVertices();
+	unsigned short *indices = skeletonRenderer.getIndices().buffer();
+	Vector<RenderCommand> &commands = skeletonRenderer.getCommands();
+	for (size_t i = 0; i < commands.size(); i++) {
+		RenderCommand &command = commands[i];
+		SDL_Texture *texture = (SDL_Texture *) command.texture;
+		switch (command.blendMode) {
 			case BlendMode_Normal:
 				SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
 				break;
@@ -173,11 +86,11 @@ void SkeletonDrawable::draw(SDL_Renderer *renderer) {
 				break;
 		}
 
-		SDL_RenderGeometry(renderer, texture, sdlVertices.buffer(), sdlVertices.size(), sdlIndices.buffer(),
-						   indicesCount);
-		clipper.clipEnd(slot);
+		SDL_Vertex *first = vertices + command.vertexStart;
+		SDL_RenderGeometryRaw(renderer, texture, &first->position.x, sizeof(SDL_Vertex), &first->color, sizeof(SDL_Vertex),
+							  &first->tex_coord.x, sizeof(SDL_Vertex), (int) command.vertexCount,
+							  indices + command.indexStart, (int) command.indexCount, sizeof(unsigned short));
 	}
-	clipper.clipEnd();
 }
 
 SDL_Texture *loadTexture(SDL_Renderer *renderer, const String &path) {
@@ -198,9 +111,115 @@ SDL_Texture *loadTexture(SDL_Renderer *renderer, const String &path) {
 	return texture;
 }
 
+// Decodes page images on worker threads, in the order the pages were loaded.
+struct SDLTextureLoader::Decoder {
+	struct Image {
+		SDL_Texture *texture;
+		String path;
+		stbi_uc *data;
+		int width;
+		bool decoded;
+	};
+
+	std::mutex mutex;
+	std::condition_variable queued, decoded;
+	std::vector<std::thread> threads;
+	std::vector<Image> images;
+	size_t nextImage;
+	bool exit;
+
+	explicit Decoder(int numThreads) : nextImage(0), exit(false) {
+		if (numThreads < 1) numThreads = 1;
+		for (int i = 0; i < numThreads; i++)
+			threads.push_back(std::thread(&Decoder::work, this));
+	}
+
+	void add(SDL_Texture *texture, const String &path) {
+		Image image;
+		image.texture = texture;
+		image.path = path;
+		image.data = nullptr;
+		image.width = 0;
+		image.decoded = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			images.push_back(image);
+		}
+		queued.notify_one();
+	}
+
+	void work() {
+		while (true) {
+			size_t index;
+			String path;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				queued.wait(lock, [this] { return exit || nextImage < images.size(); });
+				if (nextImage == images.size()) return;
+				index = nextImage++;
+				path = images[index].path;
+			}
+			int width, height, components;
+			stbi_uc *data = stbi_load(path.buffer(), &width, &height, &components, 4);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				images[index].data = data;
+				images[index].width = width;
+				images[index].decoded = true;
+			}
+			decoded.notify_all();
+		}
+	}
+
+	// Uploads each image as soon as it is decoded, then stops the worker threads.
+	void finish() {
+		std::unique_lock<std::mutex> lock(mutex);
+		for (size_t i = 0; i < images.size(); i++) {
+			decoded.wait(lock, [this, i] { return images[i].decoded; });
+			Image image = images[i];
+			lock.unlock();
+			if (image.data) {
+				if (image.texture) SDL_UpdateTexture(image.texture, nullptr, image.data, image.width * 4);
+				stbi_image_free(image.data);
+			}
+			lock.lock();
+		}
+		exit = true;
+		lock.unlock();
+		queued.notify_all();
+		for (size_t i = 0; i < threads.size(); i++)
+			threads[i].join();
+	}
+};
+
+SDLTextureLoader::~SDLTextureLoader() {
+	finishLoading();
+}
+
+void SDLTextureLoader::beginLoading(int numThreads) {
+	if (!decoder) decoder = new Decoder(numThreads);
+}
+
+void SDLTextureLoader::finishLoading() {
+	if (!decoder) return;
+	decoder->finish();
+	delete decoder;
+	decoder = nullptr;
+}
+
 void SDLTextureLoader::load(AtlasPage &page, const String &path) {
-	SDL_Texture *texture = loadTexture(renderer, path);
-	if (!texture) return;
+	SDL_Texture *texture;
+	if (decoder) {
+		// Only the image header is read here, the texture is created now and filled by finishLoading().
+		int width, height, components;
+		if (!stbi_info(path.buffer(), &width, &height, &components)) return;
+		texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STATIC, width, height);
+		if (!texture) return;
+		decoder->add(texture, path);
+	} else {
+		texture = loadTexture(renderer, path);
+		if (!texture) return;
+	}
 	page.texture = texture;
 	SDL_QueryTexture(texture, nullptr, nullptr, &page.width, &page.height);
 	switch (page.magFilter) {
@@ -216,6 +235,12 @@ void SDLTextureLoader::load(AtlasPage &page, const String &path) {
 }
 
 void SDLTextureLoader::unload(void *texture) {
+	if (decoder) {
+		// Don't upload to a texture destroyed before finishLoading().
+		std::lock_guard<std::mutex> lock(decoder->mutex);
+		for (size_t i = 0; i < decoder->images.size(); i++)
+			if (decoder->images[i].texture == texture) decoder->images[i].texture = nullptr;
+	}
 	SDL_DestroyTexture((SDL_Texture *) texture);
 }
 
@@ -49,19 +49,30 @@ namespace spine {
 
 	private:
 		bool ownsAnimationStateData;
-		SkeletonClipping clipper;
-		Vector<float> worldVertices;
-		Vector<SDL_Vertex> sdlVertices;
-		Vector<int> sdlIndices;
+		SkeletonRenderer skeletonRenderer;
 	};
 
 	class SDLTextureLoader : public spine::TextureLoader {
+		struct Decoder;
+
 		SDL_Renderer *renderer;
+		Decoder *decoder;
 
 	public:
-		SDLTextureLoader(SDL_Renderer *renderer) : renderer(renderer) {
+		SDLTextureLoader(SDL_Renderer *renderer) : renderer(renderer), decoder(nullptr) {
 		}
 
+		~SDLTextureLoader();
+
+		/// Pages loaded until finishLoading() is called get their texture created right away, but their images are
+		/// decoded on numThreads worker threads. Decoding overlaps with parsing the atlas and any skeleton data loaded in
+		/// between.
+		void beginLoading(int numThreads);
+
+		/// Waits for the images of the pages loaded since beginLoading() and uploads them to their textures. Must be called
+		/// on the render thread before the textures are drawn.
+		void finishLoading();
+
 		void load(AtlasPage &page, const String &path);
 
 		void unload(void *texture);